@@ -0,0 +1,198 @@
+/**
+ * @file test_k_way_merge.cpp - Tests for loser tree k-way merge.
+ * 
+ * @copyright Copyright (c) 2025 YH Choi. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "../../test.h"
+#include "../../../src/algo/merge/k_way_merge.h"
+
+#include <iostream>
+#include <string>
+#include <sstream>
+
+namespace {
+    /**
+     * @brief An element remembering the run it came from.
+     */
+    struct Tagged {
+        int value;
+        size_t run;
+
+        bool operator<(const Tagged &other) const {
+            return value < other.value;
+        }
+    };
+
+    /**
+     * @brief A sink counting the elements passed to it.
+     */
+    struct CountingSink {
+        size_t *count;
+
+        void operator()(const int) {
+            ++(*count);
+        }
+    };
+}
+
+TEST_BEGIN(no_runs)
+{
+    int output [1] = {42};
+    ASSERT_EQUALS(yh::algo::merge::k_way_merge<int>(nullptr, nullptr, 0, output), 0);
+    ASSERT_EQUALS(output[0], 42);
+}
+TEST_END()
+
+TEST_BEGIN(one_run_passes_through)
+{
+    const int run [] = {1, 2, 2, 5};
+    const int *const runs [] = {run};
+    const size_t lengths [] = {4};
+    int output [4];
+    ASSERT_EQUALS(yh::algo::merge::k_way_merge(runs, lengths, 1, output), 4);
+    for (size_t i = 0; i < 4; i++) {
+        ASSERT_EQUALS(output[i], run[i]);
+    }
+}
+TEST_END()
+
+TEST_BEGIN(two_runs)
+{
+    const int lhs [] = {1, 4, 6};
+    const int rhs [] = {2, 3, 7, 8};
+    const int *const runs [] = {lhs, rhs};
+    const size_t lengths [] = {3, 4};
+    int output [7];
+    ASSERT_EQUALS(yh::algo::merge::k_way_merge(runs, lengths, 2, output), 7);
+    const int results [] = {1, 2, 3, 4, 6, 7, 8};
+    for (size_t i = 0; i < 7; i++) {
+        ASSERT_EQUALS(output[i], results[i]);
+    }
+}
+TEST_END()
+
+TEST_BEGIN(many_runs_with_empty_runs)
+{
+    // run i holds the multiples of 7 congruent to i modulo 7, so every value appears exactly once
+    const size_t count = 7;
+    int values [count][20];
+    const int *runs [count];
+    size_t lengths [count];
+    for (size_t i = 0; i < count; i++) {
+        lengths[i] = (i == 3) ? 0 : 20;
+        for (size_t j = 0; j < 20; j++) {
+            values[i][j] = (int)(j * count + i);
+        }
+        runs[i] = values[i];
+    }
+    int output [count * 20];
+    ASSERT_EQUALS(yh::algo::merge::k_way_merge(runs, lengths, count, output), (count - 1) * 20);
+    for (size_t i = 1; i < (count - 1) * 20; i++) {
+        ASSERT_TRUE(output[i - 1] < output[i]);
+    }
+}
+TEST_END()
+
+TEST_BEGIN(merge_is_stable)
+{
+    const size_t count = 5;
+    Tagged values [count][6];
+    const Tagged *runs [count];
+    size_t lengths [count];
+    for (size_t i = 0; i < count; i++) {
+        for (size_t j = 0; j < 6; j++) {
+            values[i][j].value = (int)(j / 2);
+            values[i][j].run = i;
+        }
+        runs[i] = values[i];
+        lengths[i] = 6;
+    }
+    Tagged output [count * 6];
+    yh::algo::merge::k_way_merge(runs, lengths, count, output);
+    for (size_t i = 1; i < count * 6; i++) {
+        ASSERT_TRUE(output[i - 1].value <= output[i].value);
+        if (output[i - 1].value == output[i].value) {
+            ASSERT_TRUE(output[i - 1].run <= output[i].run);
+        }
+    }
+}
+TEST_END()
+
+TEST_BEGIN(descending_sources_to_sink)
+{
+    const int first [] = {9, 5, 1};
+    const int second [] = {8, 4};
+    const int third [] = {7, 6, 3, 2};
+    yh::algo::merge::ArraySource<int> sources [] = {
+        yh::algo::merge::ArraySource<int>(first, 3),
+        yh::algo::merge::ArraySource<int>(second, 2),
+        yh::algo::merge::ArraySource<int>(third, 4)
+    };
+    size_t count = 0;
+    CountingSink sink = { &count };
+    yh::algo::merge::k_way_merge(sources, 3, sink, yh::utility::Greater());
+    ASSERT_EQUALS(count, 9);
+    ASSERT_TRUE(sources[0].peek() == nullptr);
+    ASSERT_TRUE(sources[1].peek() == nullptr);
+    ASSERT_TRUE(sources[2].peek() == nullptr);
+}
+TEST_END()
+
+TEST_BEGIN(loser_tree_reports_sources)
+{
+    const int first [] = {2, 5};
+    const int second [] = {1, 5};
+    const int third [] = {3};
+    yh::algo::merge::ArraySource<int> sources [] = {
+        yh::algo::merge::ArraySource<int>(first, 2),
+        yh::algo::merge::ArraySource<int>(second, 2),
+        yh::algo::merge::ArraySource<int>(third, 1)
+    };
+    yh::algo::merge::LoserTree<yh::algo::merge::ArraySource<int> > tree(sources, 3);
+    const size_t expected [] = {1, 0, 2, 0, 1};
+    for (size_t i = 0; i < 5; i++) {
+        ASSERT_TRUE(tree.top() != nullptr);
+        ASSERT_EQUALS(tree.topSource(), expected[i]);
+        tree.pop();
+    }
+    ASSERT_TRUE(tree.top() == nullptr);
+}
+TEST_END()
+
+const testfunc_t functions [] = {
+    test_no_runs,
+    test_one_run_passes_through,
+    test_two_runs,
+    test_many_runs_with_empty_runs,
+    test_merge_is_stable,
+    test_descending_sources_to_sink,
+    test_loser_tree_reports_sources,
+};
+
+MAIN();
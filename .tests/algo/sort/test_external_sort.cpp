@@ -0,0 +1,87 @@
+/**
+ * @file test_external_sort.cpp - Tests for external sort.
+ * 
+ * @copyright Copyright (c) 2025 YH Choi. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "../../../src/algo/sort/external_sort.h"
+
+#include <cstdio>
+#include <iostream>
+#include <stdlib.h>
+#include <unistd.h>
+
+template<typename T>
+bool check(T *const elements, const T *const results, const size_t len) {
+    char inputPath[] = "/tmp/test_external_sort_in_XXXXXX";
+    char outputPath[] = "/tmp/test_external_sort_out_XXXXXX";
+    const int inputFd = mkstemp(inputPath);
+    const int outputFd = mkstemp(outputPath);
+    if (inputFd < 0 || outputFd < 0) {
+        return false;
+    }
+    close(inputFd);
+    close(outputFd);
+
+    FILE *file = fopen(inputPath, "wb");
+    const bool written = (fwrite(elements, sizeof(T), len, file) == len);
+    fclose(file);
+
+    // a budget of 8 records and a fan-in of 3 make many runs and several merge passes
+    const bool sorted = written && yh::algo::sort::external_sort<T>(inputPath, outputPath, 8 * sizeof(T), 3);
+
+    file = fopen(outputPath, "rb");
+    const size_t read = fread(elements, sizeof(T), len + 1, file);
+    fclose(file);
+    remove(inputPath);
+    remove(outputPath);
+
+    if (!sorted || read != len) {
+        return false;
+    }
+    for (size_t i = 0; i < len; i++) {
+        if (elements[i] != results[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+#include "test_sort.h"
+
+int main() {
+    std::cout << "Testing " << __FILE__ << std::endl;
+    const unsigned int failed_testcase_count = test();
+    if (failed_testcase_count == 0) {
+        std::cout << "All passed: ";
+    } else {
+        std::cout << failed_testcase_count << " failed: ";
+    }
+    std::cout << __FILE__ << std::endl;
+    return failed_testcase_count;
+}
\ No newline at end of file
@@ -0,0 +1,192 @@
+/**
+ * @file test_radix_sort.cpp - Tests for radix sort.
+ * 
+ * @copyright Copyright (c) 2025 YH Choi. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "../../../src/algo/sort/radix_sort.h"
+#include "../../../src/algo/sort/merge_sort.h"
+
+#include <cmath>
+#include <iostream>
+
+template<typename T>
+bool check(T *const elements, const T *const results, const size_t len) {
+    yh::algo::sort::radix_sort(elements, 0, len);
+    for (size_t i = 0; i < len; i++) {
+        if (elements[i] != results[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+#include "test_sort.h"
+
+// sorts a copy of the elements with radix sort and with the caller buffer, and compares both to merge sort
+template<typename T>
+unsigned int test_keys(const char *const name, const T *const elements, const size_t len) {
+    T *const results = new T[len];
+    T *const sorted = new T[len];
+    T *const buffered = new T[len];
+    T *const buffer = new T[len];
+    for (size_t i = 0; i < len; i++) {
+        results[i] = elements[i];
+        sorted[i] = elements[i];
+        buffered[i] = elements[i];
+    }
+    yh::algo::sort::merge_sort(results, 0, len);
+    yh::algo::sort::radix_sort(sorted, 0, len);
+    yh::algo::sort::radix_sort(buffered, 0, len, buffer);
+    bool passed = true;
+    for (size_t i = 0; i < len; i++) {
+        if (sorted[i] != results[i] || buffered[i] != results[i]) {
+            passed = false;
+        }
+    }
+    delete[] results;
+    delete[] sorted;
+    delete[] buffered;
+    delete[] buffer;
+    if (!passed) {
+        std::cout << "Failed: " << name << std::endl;
+    }
+    return passed ? 0 : 1;
+}
+
+unsigned int test_integers() {
+    static const size_t LENGTH = 5000;
+    unsigned int failed_testcase_count = 0;
+
+    signed char *const bytes = new signed char[LENGTH];
+    char *const chars = new char[LENGTH];
+    for (size_t i = 0; i < LENGTH; i++) {
+        bytes[i] = (signed char)(next_random() % 256 - 128);
+        chars[i] = (char)(next_random() % 256);
+    }
+    failed_testcase_count += test_keys("signed char", bytes, LENGTH);
+    failed_testcase_count += test_keys("char", chars, LENGTH);
+    delete[] bytes;
+    delete[] chars;
+
+    unsigned int *const unsigneds = new unsigned int[LENGTH];
+    for (size_t i = 0; i < LENGTH; i++) {
+        unsigneds[i] = next_random();
+    }
+    failed_testcase_count += test_keys("unsigned", unsigneds, LENGTH);
+    delete[] unsigneds;
+
+    long long *const longs = new long long[LENGTH];
+    for (size_t i = 0; i < LENGTH; i++) {
+        longs[i] = (long long)(((unsigned long long)next_random() << 32) | next_random());
+    }
+    failed_testcase_count += test_keys("long long", longs, LENGTH);
+    delete[] longs;
+
+    return failed_testcase_count;
+}
+
+// checks that -0.0 goes before +0.0, which compare equal
+template<typename T>
+bool is_zero_sign_ordered(const T *const elements, const size_t len) {
+    for (size_t i = 1; i < len; i++) {
+        if (elements[i - 1] == 0 && elements[i] == 0 && !std::signbit(elements[i - 1]) && std::signbit(elements[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// mixes negative and positive numbers, both zeros and the infinities
+template<typename T>
+unsigned int test_floating_point(const char *const name) {
+    static const size_t LENGTH = 5000;
+    T *const elements = new T[LENGTH];
+    for (size_t i = 0; i < LENGTH; i++) {
+        switch (next_random() % 8) {
+            case 0: elements[i] = (T)-0.0; break;
+            case 1: elements[i] = (T)0.0; break;
+            case 2: elements[i] = (T)((int)(next_random() % 2001) - 1000) * (T)1e30; break;
+            case 3: elements[i] = (T)((int)(next_random() % 2001) - 1000) * (T)1e-30; break;
+            default: elements[i] = (T)((int)(next_random() % 2001) - 1000) / 8; break;
+        }
+    }
+    elements[0] = -INFINITY;
+    elements[1] = INFINITY;
+    unsigned int failed_testcase_count = test_keys(name, elements, LENGTH);
+
+    yh::algo::sort::radix_sort(elements, 0, LENGTH);
+    if (!is_zero_sign_ordered(elements, LENGTH)) {
+        std::cout << "Failed: " << name << " signed zeros" << std::endl;
+        failed_testcase_count++;
+    }
+    delete[] elements;
+    return failed_testcase_count;
+}
+
+struct RecordKey {
+    unsigned int operator()(const Record &record) const {
+        return record.key;
+    }
+};
+
+unsigned int test_stable(const unsigned int modulus) {
+    static const size_t LENGTH = 20000;
+    Record *const records = new Record[LENGTH];
+    Record *const buffer = new Record[LENGTH];
+    fill_records(records, LENGTH, modulus);
+    yh::algo::sort::radix_sort(records, 0, LENGTH, RecordKey());
+    bool passed = is_stably_sorted(records, LENGTH);
+    fill_records(records, LENGTH, modulus);
+    yh::algo::sort::radix_sort(records, 0, LENGTH, RecordKey(), buffer);
+    passed = passed && is_stably_sorted(records, LENGTH);
+    delete[] records;
+    delete[] buffer;
+    if (!passed) {
+        std::cout << "Failed: stability, modulus " << modulus << std::endl;
+    }
+    return passed ? 0 : 1;
+}
+
+int main() {
+    std::cout << "Testing " << __FILE__ << std::endl;
+    unsigned int failed_testcase_count = test();
+    failed_testcase_count += test_integers();
+    failed_testcase_count += test_floating_point<float>("float");
+    failed_testcase_count += test_floating_point<double>("double");
+    failed_testcase_count += test_stable(3);
+    failed_testcase_count += test_stable(20);
+    failed_testcase_count += test_stable(0xFFFFFFFFU);
+    if (failed_testcase_count == 0) {
+        std::cout << "All passed: ";
+    } else {
+        std::cout << failed_testcase_count << " failed: ";
+    }
+    std::cout << __FILE__ << std::endl;
+    return failed_testcase_count;
+}
\ No newline at end of file
@@ -0,0 +1,92 @@
+/**
+ * @file test_sample_sort.cpp - Tests for sample sort.
+ * 
+ * @copyright Copyright (c) 2025 YH Choi. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "../../../src/algo/sort/sample_sort.h"
+
+#include <iostream>
+
+template<typename T>
+bool check(T *const elements, const T *const results, const size_t len) {
+    yh::algo::sort::sample_sort(elements, 0, len, 4, 8);
+    for (size_t i = 0; i < len; i++) {
+        if (elements[i] != results[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+#include "test_sort.h"
+
+// the test cases are short enough to be sorted by pdq sort, so long arrays exercise the partitioning
+unsigned int test_long(const unsigned int modulus, const size_t maxThreads) {
+    static const size_t LENGTH = 200000;
+    unsigned int *const elements = new unsigned int[LENGTH];
+    unsigned long long counts [256] = {};
+    fill_random(elements, LENGTH, modulus);
+    for (size_t i = 0; i < LENGTH; i++) {
+        counts[elements[i] % 256]++;
+    }
+    yh::algo::sort::sample_sort(elements, 0, LENGTH, maxThreads, 16384);
+    bool passed = true;
+    for (size_t i = 0; i < LENGTH; i++) {
+        if (i > 0 && elements[i - 1] > elements[i]) {
+            passed = false;
+        }
+        counts[elements[i] % 256]--;
+    }
+    for (size_t i = 0; i < 256; i++) {
+        if (counts[i] != 0) {
+            passed = false;
+        }
+    }
+    delete[] elements;
+    if (!passed) {
+        std::cout << "Failed: long array, modulus " << modulus << ", " << maxThreads << " threads" << std::endl;
+    }
+    return passed ? 0 : 1;
+}
+
+int main() {
+    std::cout << "Testing " << __FILE__ << std::endl;
+    unsigned int failed_testcase_count = test();
+    failed_testcase_count += test_long(0xFFFFFFFFU, 1);
+    failed_testcase_count += test_long(0xFFFFFFFFU, 4);
+    failed_testcase_count += test_long(3, 4);
+    failed_testcase_count += test_long(1000, 4);
+    if (failed_testcase_count == 0) {
+        std::cout << "All passed: ";
+    } else {
+        std::cout << failed_testcase_count << " failed: ";
+    }
+    std::cout << __FILE__ << std::endl;
+    return failed_testcase_count;
+}
\ No newline at end of file
@@ -41,6 +41,64 @@ void print_array(const int array [], const size_t len) {
     }
 }
 
+// processors without the instruction sets a test is built with cannot run it
+bool is_isa_supported() {
+#if defined(__AVX2__)
+    return __builtin_cpu_supports("avx2");
+#elif defined(__SSE4_1__)
+    return __builtin_cpu_supports("sse4.1");
+#else
+    return true;
+#endif
+}
+
+// the state of the pseudo-random generator, so that every run of a test sees the same values
+unsigned long long random_state = 12345;
+
+// gets the next value of a 64-bit linear congruential generator, whose upper bits are the most random
+unsigned int next_random() {
+    random_state = random_state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (unsigned int)(random_state >> 32);
+}
+
+// fills an array with random values less than a modulus
+template<typename T>
+void fill_random(T *const elements, const size_t len, const unsigned int modulus) {
+    for (size_t i = 0; i < len; i++) {
+        elements[i] = (T)(next_random() % modulus);
+    }
+}
+
+// an element with a key to be sorted by, and its original index to check stability
+struct Record {
+    unsigned int key;
+    unsigned int order;
+};
+
+struct ByKey {
+    bool operator()(const Record &lhs, const Record &rhs) const {
+        return lhs.key < rhs.key;
+    }
+};
+
+// fills records with random keys less than a modulus, in their original order
+void fill_records(Record *const records, const size_t len, const unsigned int modulus) {
+    for (size_t i = 0; i < len; i++) {
+        records[i].key = next_random() % modulus;
+        records[i].order = (unsigned int)i;
+    }
+}
+
+// checks that records are sorted by key, and that records of equal keys keep their original order
+bool is_stably_sorted(const Record *const records, const size_t len) {
+    for (size_t i = 1; i < len; i++) {
+        if (records[i - 1].key > records[i].key || (records[i - 1].key == records[i].key && records[i - 1].order > records[i].order)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 unsigned int test() {
     unsigned int failed_testcase_count = 0;
     size_t testcase_index = 0;
@@ -272,6 +330,50 @@ unsigned int test() {
         RESULTS ({-70, -68, -61, -53, -42, -41, -35, -27, -22, -3, 19, 19, 23, 28, 58, 72, 89, 96})
         CHECK   (18)
     }
+
+    #define GENERATE(n, element, result) \
+        static int elements [n]; \
+        static int results [n]; \
+        for (size_t i = 0; i < (n); i++) { \
+            elements[i] = (element); \
+            results[i] = (result); \
+        }
+
+    {
+        // ascending
+        GENERATE(1000, (int)i, (int)i)
+        CHECK   (1000)
+    }
+    {
+        // descending
+        GENERATE(1000, (int)(999 - i), (int)i)
+        CHECK   (1000)
+    }
+    {
+        // all equal
+        GENERATE(1000, 7, 7)
+        CHECK   (1000)
+    }
+    {
+        // organ pipe
+        GENERATE(1000, (int)((i < 500) ? i : (999 - i)), (int)(i / 2))
+        CHECK   (1000)
+    }
+    {
+        // sawtooth
+        GENERATE(1000, (int)(i % 10), (int)(i / 100))
+        CHECK   (1000)
+    }
+    {
+        // scrambled permutation
+        GENERATE(1000, (int)((i * 7919) % 1000), (int)i)
+        CHECK   (1000)
+    }
+    {
+        // scrambled permutation with negatives
+        GENERATE(1000, (int)((i * 389) % 1000) - 500, (int)i - 500)
+        CHECK   (1000)
+    }
     return failed_testcase_count;
 }
 
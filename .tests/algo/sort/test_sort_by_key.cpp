@@ -0,0 +1,145 @@
+/**
+ * @file test_sort_by_key.cpp - Tests for key/value parallel array sorts.
+ * 
+ * @copyright Copyright (c) 2025 YH Choi. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "../../../src/algo/sort/sort_by_key.h"
+
+#include <iostream>
+
+// every value is the original index of its key, so it shows whether it has moved with its key,
+// and whether equal keys have kept their relative order
+template<typename T>
+bool check_values(const T *const keys, const size_t *const values, const T *const originals, const T *const results, const size_t len, const bool stable) {
+    for (size_t i = 0; i < len; i++) {
+        if (keys[i] != results[i] || values[i] >= len || originals[values[i]] != keys[i]) {
+            return false;
+        }
+        if (stable && i > 0 && keys[i - 1] == keys[i] && values[i - 1] > values[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void fill_indices(size_t *const values, const size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        values[i] = i;
+    }
+}
+
+template<typename T>
+bool check(T *const elements, const T *const results, const size_t len) {
+    T *const originals = new T[len + 1];
+    T *const keys = new T[len + 1];
+    size_t *const values = new size_t[len + 1];
+    T *const keyBuffer = new T[len + 1];
+    size_t *const valueBuffer = new size_t[len + 1];
+    for (size_t i = 0; i < len; i++) {
+        originals[i] = elements[i];
+        keys[i] = elements[i];
+    }
+    fill_indices(values, len);
+    yh::algo::sort::quick_sort_by_key(keys, values, 0, len);
+    bool passed = check_values(keys, values, originals, results, len, false);
+
+    for (size_t i = 0; i < len; i++) {
+        keys[i] = elements[i];
+    }
+    fill_indices(values, len);
+    yh::algo::sort::merge_sort_by_key(keys, values, 0, len, keyBuffer, valueBuffer);
+    passed = passed && check_values(keys, values, originals, results, len, true);
+
+    fill_indices(values, len);
+    yh::algo::sort::merge_sort_by_key(elements, values, 0, len);
+    passed = passed && check_values(elements, values, originals, results, len, true);
+
+    delete[] originals;
+    delete[] keys;
+    delete[] values;
+    delete[] keyBuffer;
+    delete[] valueBuffer;
+    return passed;
+}
+
+#include "test_sort.h"
+
+// long arrays with few distinct keys take the merging path with many equal keys
+unsigned int test_stable(const unsigned int modulus) {
+    static const size_t LENGTH = 20000;
+    unsigned int *const originals = new unsigned int[LENGTH];
+    unsigned int *const keys = new unsigned int[LENGTH];
+    unsigned int *const results = new unsigned int[LENGTH];
+    size_t *const values = new size_t[LENGTH];
+    unsigned int *const keyBuffer = new unsigned int[LENGTH];
+    size_t *const valueBuffer = new size_t[LENGTH];
+    fill_random(originals, LENGTH, modulus);
+    for (size_t i = 0; i < LENGTH; i++) {
+        keys[i] = originals[i];
+        results[i] = originals[i];
+    }
+    yh::algo::sort::merge_sort_by_key(results, values, 0, LENGTH);
+
+    fill_indices(values, LENGTH);
+    yh::algo::sort::merge_sort_by_key(keys, values, 0, LENGTH);
+    bool passed = check_values(keys, values, originals, results, LENGTH, true);
+
+    for (size_t i = 0; i < LENGTH; i++) {
+        keys[i] = originals[i];
+    }
+    fill_indices(values, LENGTH);
+    yh::algo::sort::merge_sort_by_key(keys, values, 0, LENGTH, keyBuffer, valueBuffer);
+    passed = passed && check_values(keys, values, originals, results, LENGTH, true);
+
+    delete[] originals;
+    delete[] keys;
+    delete[] results;
+    delete[] values;
+    delete[] keyBuffer;
+    delete[] valueBuffer;
+    if (!passed) {
+        std::cout << "Failed: stability, modulus " << modulus << std::endl;
+    }
+    return passed ? 0 : 1;
+}
+
+int main() {
+    std::cout << "Testing " << __FILE__ << std::endl;
+    unsigned int failed_testcase_count = test();
+    failed_testcase_count += test_stable(3);
+    failed_testcase_count += test_stable(20);
+    failed_testcase_count += test_stable(0xFFFFFFFFU);
+    if (failed_testcase_count == 0) {
+        std::cout << "All passed: ";
+    } else {
+        std::cout << failed_testcase_count << " failed: ";
+    }
+    std::cout << __FILE__ << std::endl;
+    return failed_testcase_count;
+}
\ No newline at end of file
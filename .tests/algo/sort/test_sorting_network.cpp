@@ -0,0 +1,210 @@
+/**
+ * @file test_sorting_network.cpp - Tests for sorting networks.
+ * 
+ * @copyright Copyright (c) 2025 YH Choi. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "../../../src/algo/sort/insertion_sort.h"
+#include "../../../src/algo/sort/sorting_network.h"
+
+#include <iostream>
+
+#ifndef TEST_FILE
+#define TEST_FILE __FILE__
+#endif
+
+using yh::algo::sort::_sorting_network::MAX_LENGTH;
+
+template<typename T>
+bool check(T *const elements, const T *const results, const size_t len) {
+    // sort every block of up to MAX_LENGTH elements with its network, and require each block to be sorted on its own
+    for (size_t start = 0; start < len; start += MAX_LENGTH) {
+        const size_t blockLength = (len - start < MAX_LENGTH) ? len - start : MAX_LENGTH;
+        yh::algo::sort::_sorting_network::sort_small(elements + start, blockLength);
+        for (size_t i = start + 1; i < start + blockLength; i++) {
+            if (elements[i] < elements[i - 1]) {
+                return false;
+            }
+        }
+    }
+    if (len > MAX_LENGTH) {
+        // the blocks are sorted, so merging them only checks that no element is lost
+        yh::algo::sort::insertion_sort(elements, 0, len);
+    }
+    for (size_t i = 0; i < len; i++) {
+        if (elements[i] != results[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+#include "test_sort.h"
+
+namespace {
+    // gets a random value in [ -modulus / 2 : modulus - modulus / 2 )
+    int centered_random(const int modulus) {
+        return (int)(next_random() % (unsigned int)modulus) - modulus / 2;
+    }
+
+    // fills an array with one of several patterns, many of them with duplicates
+    template<typename T>
+    void fill(T *const elements, const size_t len, const int pattern) {
+        for (size_t i = 0; i < len; i++) {
+            switch (pattern) {
+                case 0: elements[i] = (T)centered_random(2000000000); break;
+                case 1: elements[i] = (T)centered_random(3); break;
+                case 2: elements[i] = (T)(len - i); break;
+                case 3: elements[i] = (T)i; break;
+                case 4: elements[i] = (T)7; break;
+                default: elements[i] = (T)((i % 2 == 0) ? centered_random(100) : -(int)i); break;
+            }
+        }
+    }
+
+    template<typename T>
+    bool is_sorted_copy(const T *const elements, const T *const original, const size_t len) {
+        T results [64];
+        for (size_t i = 0; i < len; i++) {
+            results[i] = original[i];
+        }
+        yh::algo::sort::insertion_sort(results, 0, len);
+        for (size_t i = 0; i < len; i++) {
+            if (elements[i] != results[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // sorts every length up to MAX_LENGTH with its network alone
+    template<typename T>
+    unsigned int test_small_lengths(const char *const typeName) {
+        unsigned int failed = 0;
+        for (size_t len = 0; len <= MAX_LENGTH; len++) {
+            for (int pattern = 0; pattern < 6; pattern++) {
+                for (int round = 0; round < 20; round++) {
+                    T elements [MAX_LENGTH];
+                    T original [MAX_LENGTH];
+                    fill(original, len, pattern);
+                    for (size_t i = 0; i < len; i++) {
+                        elements[i] = original[i];
+                    }
+                    yh::algo::sort::_sorting_network::sort_small(elements, len);
+                    if (!is_sorted_copy(elements, original, len)) {
+                        std::cout << "Failed: sort_small<" << typeName << ">, length " << len << ", pattern " << pattern << std::endl;
+                        failed++;
+                        break;
+                    }
+                }
+            }
+        }
+        return failed;
+    }
+
+    // sorts N elements with sort_n with and without comparators, then checks N - 1
+    template<size_t N, typename T>
+    struct CheckSortN {
+        static unsigned int apply(const char *const typeName) {
+            unsigned int failed = 0;
+            for (int pattern = 0; pattern < 6; pattern++) {
+                T original [N];
+                T elements [N];
+                T compared [N];
+                T reversed [N];
+                fill(original, N, pattern);
+                for (size_t i = 0; i < N; i++) {
+                    elements[i] = original[i];
+                    compared[i] = original[i];
+                    reversed[i] = original[i];
+                }
+                yh::algo::sort::sort_n<N>(elements);
+                yh::algo::sort::sort_n<N>(compared, yh::utility::Less());
+                yh::algo::sort::sort_n<N>(reversed, yh::utility::Greater());
+                bool passed = is_sorted_copy(elements, original, N) && is_sorted_copy(compared, original, N);
+                for (size_t i = 0; i < N; i++) {
+                    passed = passed && reversed[i] == elements[N - 1 - i];
+                }
+                if (!passed) {
+                    std::cout << "Failed: sort_n<" << N << ", " << typeName << ">, pattern " << pattern << std::endl;
+                    failed++;
+                }
+            }
+            return failed + CheckSortN<N - 1, T>::apply(typeName);
+        }
+    };
+
+    template<typename T>
+    struct CheckSortN<0, T> {
+        static unsigned int apply(const char *const) {
+            T elements [1] = {T(3)};
+            yh::algo::sort::sort_n<0>(elements);
+            yh::algo::sort::sort_n<0>(elements, yh::utility::Less());
+            return (elements[0] == T(3)) ? 0 : 1;
+        }
+    };
+
+    // lengths beyond MAX_LENGTH are checked one by one rather than down to 0
+    template<size_t N, typename T>
+    unsigned int test_sort_n_long(const char *const typeName) {
+        T elements [N];
+        fill(elements, N, 2);
+        T original [N];
+        for (size_t i = 0; i < N; i++) {
+            original[i] = elements[i];
+        }
+        yh::algo::sort::sort_n<N>(elements, yh::utility::Less());
+        if (!is_sorted_copy(elements, original, N)) {
+            std::cout << "Failed: sort_n<" << N << ", " << typeName << "> with Less" << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+}
+
+int main() {
+    std::cout << "Testing " << TEST_FILE << std::endl;
+    if (!is_isa_supported()) {
+        std::cout << "All passed: " << TEST_FILE << " (skipped, instruction set not supported)" << std::endl;
+        return 0;
+    }
+    unsigned int failed_testcase_count = test();
+    failed_testcase_count += test_small_lengths<int>("int");
+    failed_testcase_count += test_small_lengths<float>("float");
+    failed_testcase_count += CheckSortN<MAX_LENGTH, int>::apply("int");
+    failed_testcase_count += CheckSortN<MAX_LENGTH, float>::apply("float");
+    failed_testcase_count += test_sort_n_long<40, int>("int");
+    failed_testcase_count += test_sort_n_long<64, float>("float");
+    if (failed_testcase_count == 0) {
+        std::cout << "All passed: ";
+    } else {
+        std::cout << failed_testcase_count << " failed: ";
+    }
+    std::cout << TEST_FILE << std::endl;
+    return failed_testcase_count;
+}
\ No newline at end of file
@@ -0,0 +1,172 @@
+/**
+ * @file test_string_sort.cpp - Tests for string sort.
+ * 
+ * @copyright Copyright (c) 2025 YH Choi. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "../../test.h"
+#include "../../../src/algo/sort/string_sort.h"
+
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <sstream>
+
+namespace {
+    /**
+     * @brief A user string type, read through its own specialization of the traits.
+     */
+    struct Name {
+        char letters [8];
+    };
+
+    /**
+     * @brief Whether NUL-terminated strings are in ascending order.
+     */
+    bool is_sorted(const char *const *const strings, const size_t length) {
+        for (size_t i = 1; i < length; i++) {
+            if (strcmp(strings[i - 1], strings[i]) > 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+namespace yh {
+    namespace algo {
+        namespace sort {
+            template<>
+            struct StringTraits<Name> {
+                static inline int at(const Name &name, const size_t index) {
+                    return (index < 8 && name.letters[index] != '\0') ? (int)(unsigned char)name.letters[index] : -1;
+                }
+            };
+        }
+    }
+}
+
+TEST_BEGIN(c_strings)
+{
+    const char *strings [] = {"banana", "apple", "cherry", "app", "", "apple", "banan", "b"};
+    yh::algo::sort::string_sort(strings, 0, 8);
+    const char *const results [] = {"", "app", "apple", "apple", "b", "banan", "banana", "cherry"};
+    for (size_t i = 0; i < 8; i++) {
+        ASSERT_EQUALS(std::string(strings[i]), std::string(results[i]));
+    }
+}
+TEST_END()
+
+TEST_BEGIN(sub_range)
+{
+    const char *strings [] = {"z", "c", "b", "a", "y"};
+    yh::algo::sort::string_sort(strings, 1, 4);
+    ASSERT_EQUALS(std::string(strings[0]), "z");
+    ASSERT_EQUALS(std::string(strings[1]), "a");
+    ASSERT_EQUALS(std::string(strings[2]), "b");
+    ASSERT_EQUALS(std::string(strings[3]), "c");
+    ASSERT_EQUALS(std::string(strings[4]), "y");
+}
+TEST_END()
+
+TEST_BEGIN(string_refs_with_nul_and_high_characters)
+{
+    yh::algo::sort::StringRef strings [] = {
+        {"ab\0c", 4}, {"ab", 2}, {"ab\xff", 3}, {"ab\0", 3}, {"a", 1}
+    };
+    yh::algo::sort::string_sort(strings, 0, 5);
+    ASSERT_EQUALS(strings[0].length, 1);
+    ASSERT_EQUALS(strings[1].length, 2);
+    ASSERT_EQUALS(strings[2].length, 3);
+    ASSERT_EQUALS(strings[2].data[2], '\0');
+    ASSERT_EQUALS(strings[3].length, 4);
+    ASSERT_EQUALS(strings[4].length, 3);
+    ASSERT_EQUALS(strings[4].data[2], '\xff');
+}
+TEST_END()
+
+TEST_BEGIN(std_strings_with_shared_prefixes)
+{
+    std::string strings [40];
+    for (size_t i = 0; i < 40; i++) {
+        std::stringstream stream;
+        stream << "https://example.com/path/" << ((i * 17) % 40);
+        strings[i] = stream.str();
+    }
+    yh::algo::sort::string_sort(strings, 0, 40);
+    for (size_t i = 1; i < 40; i++) {
+        ASSERT_TRUE(strings[i - 1] < strings[i]);
+    }
+}
+TEST_END()
+
+TEST_BEGIN(user_string_type)
+{
+    Name names [] = {{"carol"}, {"alice"}, {"bob"}, {"alicia"}};
+    yh::algo::sort::string_sort(names, 0, 4);
+    ASSERT_EQUALS(std::string(names[0].letters), "alice");
+    ASSERT_EQUALS(std::string(names[1].letters), "alicia");
+    ASSERT_EQUALS(std::string(names[2].letters), "bob");
+    ASSERT_EQUALS(std::string(names[3].letters), "carol");
+}
+TEST_END()
+
+TEST_BEGIN(many_strings)
+{
+    // enough strings for the radix sort steps, sharing a prefix and with many duplicates
+    const size_t length = 10000;
+    char *const characters = new char[length * 16];
+    const char **const strings = new const char *[length];
+    for (size_t i = 0; i < length; i++) {
+        char *const string = characters + i * 16;
+        const size_t value = (i * 7919) % 3000;
+        strcpy(string, "/usr/");
+        for (size_t j = 0; j < value % 7; j++) {
+            string[5 + j] = (char)('a' + (value / (j + 1)) % 26);
+        }
+        string[5 + value % 7] = '\0';
+        strings[i] = string;
+    }
+    yh::algo::sort::string_sort(strings, 0, length);
+    const bool sorted = is_sorted(strings, length);
+    delete[] strings;
+    delete[] characters;
+    ASSERT_TRUE(sorted);
+}
+TEST_END()
+
+const testfunc_t functions [] = {
+    test_c_strings,
+    test_sub_range,
+    test_string_refs_with_nul_and_high_characters,
+    test_std_strings_with_shared_prefixes,
+    test_user_string_type,
+    test_many_strings,
+};
+
+MAIN();
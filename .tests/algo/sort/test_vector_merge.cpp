@@ -0,0 +1,177 @@
+/**
+ * @file test_vector_merge.cpp - Tests for the vector merge kernel of merge sorts.
+ * 
+ * @copyright Copyright (c) 2025 YH Choi. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "../../../src/algo/sort/merge_sort.h"
+#include "../../../src/algo/sort/parallel_merge_sort.h"
+#include "../../../src/algo/sort/pdq_sort.h"
+
+#include <climits>
+#include <iostream>
+
+#ifndef TEST_FILE
+#define TEST_FILE __FILE__
+#endif
+
+template<typename T>
+bool check(T *const elements, const T *const results, const size_t len) {
+    T *const copy = new T[len + 1];
+    for (size_t i = 0; i < len; i++) {
+        copy[i] = elements[i];
+    }
+    yh::algo::sort::merge_sort(elements, 0, len);
+    yh::algo::sort::parallel_merge_sort(copy, 0, len, 4, 8);
+    bool passed = true;
+    for (size_t i = 0; i < len; i++) {
+        if (elements[i] != results[i] || copy[i] != results[i]) {
+            passed = false;
+        }
+    }
+    delete[] copy;
+    return passed;
+}
+
+#include "test_sort.h"
+
+namespace {
+    // fills an array with random values, few distinct values, signed extremes around 0, or unsigned extremes
+    template<typename T>
+    void fill(T *const elements, const size_t len, const int pattern) {
+        static const unsigned int EXTREMES [] = {
+            (unsigned int)INT_MIN, (unsigned int)INT_MAX, 0U, 1U, UINT_MAX,
+            (unsigned int)INT_MIN + 1U, (unsigned int)INT_MAX - 1U, UINT_MAX - 1U
+        };
+        for (size_t i = 0; i < len; i++) {
+            const unsigned int r = next_random();
+            switch (pattern) {
+                case 0: elements[i] = (T)r; break;
+                case 1: elements[i] = (T)(r % 3); break;
+                case 2: elements[i] = (T)((r % 2 == 0) ? EXTREMES[r % 4] : (unsigned int)((int)(r % 5) - 2)); break;
+                default: elements[i] = (T)EXTREMES[r % 8]; break;
+            }
+        }
+    }
+
+    template<typename T>
+    bool is_same_array(const T *const lhs, const T *const rhs, const size_t len) {
+        for (size_t i = 0; i < len; i++) {
+            if (lhs[i] != rhs[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // merges every pair of run lengths up to 40, most of them not multiples of the vector length
+    template<typename T>
+    unsigned int test_merge(const char *const typeName) {
+        static const size_t MAX_RUN_LENGTH = 40;
+        unsigned int failed = 0;
+        for (int pattern = 0; pattern < 4; pattern++) {
+            for (size_t lhsLength = 0; lhsLength <= MAX_RUN_LENGTH; lhsLength++) {
+                for (size_t rhsLength = 0; rhsLength <= MAX_RUN_LENGTH; rhsLength++) {
+                    T runs [MAX_RUN_LENGTH * 2];
+                    T results [MAX_RUN_LENGTH * 2];
+                    T merged [MAX_RUN_LENGTH * 2];
+                    const size_t length = lhsLength + rhsLength;
+                    fill(runs, length, pattern);
+                    yh::algo::sort::pdq_sort(runs, 0, lhsLength);
+                    yh::algo::sort::pdq_sort(runs, lhsLength, length);
+                    for (size_t i = 0; i < length; i++) {
+                        results[i] = runs[i];
+                    }
+                    yh::algo::sort::pdq_sort(results, 0, length);
+                    yh::algo::sort::_merge_sort::merge(runs, runs + lhsLength, runs + lhsLength, runs + length, merged, yh::utility::Less());
+                    if (!is_same_array(merged, results, length)) {
+                        std::cout << "Failed: merge<" << typeName << ">, pattern " << pattern << ", runs of " << lhsLength << " and " << rhsLength << std::endl;
+                        failed++;
+                    }
+                }
+            }
+        }
+        return failed;
+    }
+
+    // sorts long arrays whose runs are merged many times, with lengths not multiples of the vector length
+    template<typename T>
+    unsigned int test_sorts(const char *const typeName) {
+        static const size_t LENGTHS [] = {1001, 4099, 65539};
+        unsigned int failed = 0;
+        for (int pattern = 0; pattern < 4; pattern++) {
+            for (size_t l = 0; l < sizeof(LENGTHS) / sizeof(LENGTHS[0]); l++) {
+                const size_t length = LENGTHS[l];
+                T *const elements = new T[length];
+                T *const copy = new T[length];
+                T *const results = new T[length];
+                fill(elements, length, pattern);
+                for (size_t i = 0; i < length; i++) {
+                    copy[i] = elements[i];
+                    results[i] = elements[i];
+                }
+                yh::algo::sort::pdq_sort(results, 0, length);
+                yh::algo::sort::merge_sort(elements, 0, length);
+                yh::algo::sort::parallel_merge_sort(copy, 0, length, 4, 1000);
+                if (!is_same_array(elements, results, length)) {
+                    std::cout << "Failed: merge_sort<" << typeName << ">, pattern " << pattern << ", length " << length << std::endl;
+                    failed++;
+                }
+                if (!is_same_array(copy, results, length)) {
+                    std::cout << "Failed: parallel_merge_sort<" << typeName << ">, pattern " << pattern << ", length " << length << std::endl;
+                    failed++;
+                }
+                delete[] elements;
+                delete[] copy;
+                delete[] results;
+            }
+        }
+        return failed;
+    }
+}
+
+int main() {
+    std::cout << "Testing " << TEST_FILE << std::endl;
+    if (!is_isa_supported()) {
+        std::cout << "All passed: " << TEST_FILE << " (skipped, instruction set not supported)" << std::endl;
+        return 0;
+    }
+    unsigned int failed_testcase_count = test();
+    failed_testcase_count += test_merge<int>("int");
+    failed_testcase_count += test_merge<unsigned int>("unsigned int");
+    failed_testcase_count += test_sorts<int>("int");
+    failed_testcase_count += test_sorts<unsigned int>("unsigned int");
+    if (failed_testcase_count == 0) {
+        std::cout << "All passed: ";
+    } else {
+        std::cout << failed_testcase_count << " failed: ";
+    }
+    std::cout << TEST_FILE << std::endl;
+    return failed_testcase_count;
+}
@@ -1194,6 +1194,28 @@ TEST_BEGIN(list_iterator_removed_all_elements_are_not_visible)
 }
 TEST_END()
 
+TEST_BEGIN(list_iterator_removed_ends_keep_list_linked)
+{
+    SETUP_ITERATOR_LIST();
+
+    ASSERT_NEXT_ELEMENT_IS(x, true, true);
+    ASSERT_NEXT_ELEMENT_IS(y, false, false);
+    ASSERT_NEXT_ELEMENT_IS(z, false, false);
+    ASSERT_NEXT_ELEMENT_IS(a, true, true);
+
+    ASSERT_NO_MORE_ELEMENTS();
+
+    int b = 7;
+    list.addTail(&b);
+    list.addHead(&a);
+    ASSERT_EQUALS(list.size(), 4);
+    ASSERT_EQUALS(list.getHead(), &a);
+    ASSERT_EQUALS(list.get(1), &y);
+    ASSERT_EQUALS(list.get(2), &z);
+    ASSERT_EQUALS(list.getTail(), &b);
+}
+TEST_END()
+
 TEST_BEGIN(list_expand)
 {
     LIST_TYPE<int> list;
@@ -1227,6 +1249,230 @@ TEST_BEGIN(list_shrink)
 }
 TEST_END()
 
+TEST_BEGIN(list_removeIf_many_keeps_order)
+{
+    LIST_TYPE<int> list;
+    int numbers [100];
+    for (int i = 0; i < 100; i++) {
+        numbers[i] = i;
+        list.addTail(numbers + i);
+    }
+    list.removeIf([](int *const ptr) { return (*ptr) % 3 != 0; });
+    ASSERT_EQUALS(list.size(), 34);
+    for (int i = 0; i < 34; i++) {
+        ASSERT_EQUALS(list.get(i), numbers + i * 3);
+    }
+    list.addTail(numbers + 1);
+    ASSERT_EQUALS(list.size(), 35);
+    ASSERT_EQUALS(list.getTail(), numbers + 1);
+    list.removeIf([](int *const) { return true; });
+    ASSERT_TRUE(list.isEmpty());
+    list.addHead(numbers + 2);
+    ASSERT_EQUALS(list.getHead(), numbers + 2);
+    ASSERT_EQUALS(list.getTail(), numbers + 2);
+}
+TEST_END()
+
+TEST_BEGIN(list_insertAll_array_keeps_order)
+{
+    LIST_TYPE<int> list;
+    int numbers [10];
+    for (int i = 0; i < 10; i++) {
+        numbers[i] = i;
+    }
+    for (int i = 0; i < 4; i++) {
+        list.addTail(numbers + i);
+    }
+    int *const middle [] = {numbers + 4, numbers + 5, numbers + 6};
+    list.insertAll(2, middle, 3);
+    int *const head [] = {numbers + 7, numbers + 8};
+    list.insertAll(0, head, 2);
+    int *const tail [] = {numbers + 9};
+    list.insertAll(list.size(), tail, 1);
+    list.insertAll(3, tail, 0);
+    const int expected [] = {7, 8, 0, 1, 4, 5, 6, 2, 3, 9};
+    ASSERT_EQUALS(list.size(), 10);
+    for (int i = 0; i < 10; i++) {
+        ASSERT_EQUALS(list.get(i), numbers + expected[i]);
+    }
+    list.addTail(numbers);
+    list.addHead(numbers + 1);
+    ASSERT_EQUALS(list.size(), 12);
+    ASSERT_EQUALS(list.getHead(), numbers + 1);
+    ASSERT_EQUALS(list.get(10), numbers + 9);
+    ASSERT_EQUALS(list.getTail(), numbers);
+}
+TEST_END()
+
+TEST_BEGIN(list_insertAll_array_into_empty_list)
+{
+    LIST_TYPE<int> list;
+    int numbers [100];
+    int *pointers [100];
+    for (int i = 0; i < 100; i++) {
+        numbers[i] = i;
+        pointers[i] = numbers + i;
+    }
+    list.insertAll(0, pointers, 100);
+    ASSERT_EQUALS(list.size(), 100);
+    ASSERT_EQUALS(list.getHead(), numbers);
+    ASSERT_EQUALS(list.getTail(), numbers + 99);
+    list.insertAll(50, pointers, 100);
+    ASSERT_EQUALS(list.size(), 200);
+    for (int i = 0; i < 200; i++) {
+        const int expected = (i < 50) ? i : (i < 150) ? i - 50 : i - 100;
+        ASSERT_EQUALS(list.get(i), numbers + expected);
+    }
+}
+TEST_END()
+
+TEST_BEGIN(list_insertAll_invalid_index_inserts_nothing)
+{
+    LIST_TYPE<int> list;
+    LIST_TYPE<int> other;
+    int x = 35;
+    int *const elements [] = {&x};
+    other.addTail(&x);
+    list.insertAll(1, elements, 1);
+    list.insertAll(1, other);
+    ASSERT_TRUE(list.isEmpty());
+    list.addTail(&x);
+    list.insertAll(2, elements, 1);
+    list.insertAll(2, other);
+    ASSERT_EQUALS(list.size(), 1);
+}
+TEST_END()
+
+TEST_BEGIN(list_insertAll_list_keeps_order)
+{
+    LIST_TYPE<int> list;
+    LIST_TYPE<int> other;
+    int numbers [6];
+    for (int i = 0; i < 6; i++) {
+        numbers[i] = i;
+    }
+    list.addTail(numbers);
+    list.addTail(numbers + 1);
+    list.addTail(numbers + 2);
+    other.addTail(numbers + 3);
+    other.addTail(numbers + 4);
+    other.addTail(numbers + 5);
+    list.insertAll(1, other);
+    ASSERT_EQUALS(other.size(), 3);
+    const int expected [] = {0, 3, 4, 5, 1, 2};
+    ASSERT_EQUALS(list.size(), 6);
+    for (int i = 0; i < 6; i++) {
+        ASSERT_EQUALS(list.get(i), numbers + expected[i]);
+    }
+    ASSERT_EQUALS(list.getTail(), numbers + 2);
+}
+TEST_END()
+
+TEST_BEGIN(list_insertAll_list_into_itself)
+{
+    LIST_TYPE<int> list;
+    int numbers [3] = {0, 1, 2};
+    list.addTail(numbers);
+    list.addTail(numbers + 1);
+    list.addTail(numbers + 2);
+    list.insertAll(1, list);
+    const int expected [] = {0, 0, 1, 2, 1, 2};
+    ASSERT_EQUALS(list.size(), 6);
+    for (int i = 0; i < 6; i++) {
+        ASSERT_EQUALS(list.get(i), numbers + expected[i]);
+    }
+    list.addAllTail(list);
+    ASSERT_EQUALS(list.size(), 12);
+    for (int i = 0; i < 12; i++) {
+        ASSERT_EQUALS(list.get(i), numbers + expected[i % 6]);
+    }
+    ASSERT_EQUALS(list.getTail(), numbers + 2);
+}
+TEST_END()
+
+TEST_BEGIN(list_addAllTail_appends)
+{
+    LIST_TYPE<int> list;
+    LIST_TYPE<int> other;
+    int numbers [4] = {0, 1, 2, 3};
+    int *const elements [] = {numbers, numbers + 1};
+    list.addAllTail(elements, 2);
+    other.addTail(numbers + 2);
+    other.addTail(numbers + 3);
+    list.addAllTail(other);
+    ASSERT_EQUALS(list.size(), 4);
+    for (int i = 0; i < 4; i++) {
+        ASSERT_EQUALS(list.get(i), numbers + i);
+    }
+    list.addTail(numbers);
+    ASSERT_EQUALS(list.get(3), numbers + 3);
+    ASSERT_EQUALS(list.getTail(), numbers);
+}
+TEST_END()
+
+TEST_BEGIN(list_removeRange_keeps_order)
+{
+    LIST_TYPE<int> list;
+    int numbers [100];
+    for (int i = 0; i < 100; i++) {
+        numbers[i] = i;
+        list.addTail(numbers + i);
+    }
+    ASSERT_TRUE(list.removeRange(10, 90));
+    ASSERT_EQUALS(list.size(), 20);
+    for (int i = 0; i < 20; i++) {
+        ASSERT_EQUALS(list.get(i), numbers + ((i < 10) ? i : i + 80));
+    }
+    ASSERT_TRUE(list.removeRange(0, 5));
+    ASSERT_EQUALS(list.size(), 15);
+    ASSERT_EQUALS(list.getHead(), numbers + 5);
+    ASSERT_TRUE(list.removeRange(10, 15));
+    ASSERT_EQUALS(list.size(), 10);
+    ASSERT_EQUALS(list.getTail(), numbers + 94);
+    ASSERT_TRUE(list.removeRange(3, 3));
+    ASSERT_EQUALS(list.size(), 10);
+    list.addTail(numbers);
+    list.addHead(numbers + 1);
+    ASSERT_EQUALS(list.size(), 12);
+    ASSERT_EQUALS(list.get(1), numbers + 5);
+    ASSERT_EQUALS(list.get(10), numbers + 94);
+    ASSERT_EQUALS(list.getTail(), numbers);
+}
+TEST_END()
+
+TEST_BEGIN(list_removeRange_all_elements)
+{
+    LIST_TYPE<int> list;
+    int numbers [5] = {0, 1, 2, 3, 4};
+    for (int i = 0; i < 5; i++) {
+        list.addTail(numbers + i);
+    }
+    ASSERT_TRUE(list.removeRange(0, 5));
+    ASSERT_TRUE(list.isEmpty());
+    ASSERT_IS_NULLPTR(list.getHead());
+    ASSERT_IS_NULLPTR(list.getTail());
+    ASSERT_TRUE(list.removeRange(0, 0));
+    list.addTail(numbers + 3);
+    ASSERT_EQUALS(list.getHead(), numbers + 3);
+    ASSERT_EQUALS(list.getTail(), numbers + 3);
+}
+TEST_END()
+
+TEST_BEGIN(list_removeRange_invalid_range_removes_nothing)
+{
+    LIST_TYPE<int> list;
+    int numbers [3] = {0, 1, 2};
+    for (int i = 0; i < 3; i++) {
+        list.addTail(numbers + i);
+    }
+    ASSERT_FALSE(list.removeRange(2, 1));
+    ASSERT_FALSE(list.removeRange(1, 4));
+    ASSERT_FALSE(list.removeRange(4, 4));
+    ASSERT_EQUALS(list.size(), 3);
+    ASSERT_EQUALS(list.getTail(), numbers + 2);
+}
+TEST_END()
+
 const testfunc_t functions [] = {
     test_list_is_empty_for_empty_list,
     test_list_is_not_empty_for_1_element_list_add_head,
@@ -1287,8 +1533,19 @@ const testfunc_t functions [] = {
     test_list_iterator_removed_even_elements_are_not_visible,
     test_list_iterator_removed_odd_elements_are_not_visible,
     test_list_iterator_removed_all_elements_are_not_visible,
+    test_list_iterator_removed_ends_keep_list_linked,
     test_list_expand,
     test_list_shrink,
+    test_list_removeIf_many_keeps_order,
+    test_list_insertAll_array_keeps_order,
+    test_list_insertAll_array_into_empty_list,
+    test_list_insertAll_invalid_index_inserts_nothing,
+    test_list_insertAll_list_keeps_order,
+    test_list_insertAll_list_into_itself,
+    test_list_addAllTail_appends,
+    test_list_removeRange_keeps_order,
+    test_list_removeRange_all_elements,
+    test_list_removeRange_invalid_range_removes_nothing,
 };
 
 MAIN();
@@ -0,0 +1,255 @@
+/**
+ * @file testArrayListCapacity.cpp - Tests for the capacity management of the array list.
+ * 
+ * @copyright Copyright (c) 2025 YH Choi. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "../../test.h"
+#include "../../../src/structures/lists/ArrayList.h"
+
+#include <iostream>
+
+using yh::structures::lists::ArrayList;
+
+TEST_BEGIN(array_list_has_default_capacity)
+{
+    ArrayList<int> list;
+    ASSERT_EQUALS(list.capacity(), 16);
+}
+TEST_END()
+
+TEST_BEGIN(array_list_has_given_initial_capacity)
+{
+    int elements [100];
+    ArrayList<int> list(100);
+    ASSERT_EQUALS(list.capacity(), 100);
+    for (int i = 0; i < 100; i++) {
+        list.addTail(&elements[i]);
+    }
+    ASSERT_EQUALS(list.capacity(), 100);
+    while (!list.isEmpty()) {
+        list.removeTail();
+    }
+    // the initial capacity is kept as a reservation
+    ASSERT_EQUALS(list.capacity(), 100);
+}
+TEST_END()
+
+TEST_BEGIN(array_list_grows_from_zero_initial_capacity)
+{
+    int x = 7;
+    ArrayList<int> list(0);
+    list.addTail(&x);
+    list.addTail(&x);
+    ASSERT_EQUALS(list.size(), 2);
+    ASSERT_EQUALS(list.get(1), &x);
+}
+TEST_END()
+
+TEST_BEGIN(array_list_reserve_keeps_elements)
+{
+    int elements [20];
+    ArrayList<int> list;
+    for (int i = 0; i < 20; i++) {
+        list.addTail(&elements[i]);
+    }
+    ASSERT_TRUE(list.reserve(1000));
+    ASSERT_EQUALS(list.capacity(), 1000);
+    ASSERT_TRUE(list.reserve(10));
+    ASSERT_EQUALS(list.capacity(), 1000);
+    ASSERT_EQUALS(list.size(), 20);
+    for (int i = 0; i < 20; i++) {
+        ASSERT_EQUALS(list.get(i), &elements[i]);
+    }
+}
+TEST_END()
+
+TEST_BEGIN(array_list_reserved_capacity_is_not_shrunk)
+{
+    int elements [600];
+    ArrayList<int> list;
+    list.reserve(512);
+    for (int i = 0; i < 600; i++) {
+        list.addTail(&elements[i]);
+    }
+    ASSERT_EQUALS(list.capacity(), 1024);
+    while (!list.isEmpty()) {
+        list.removeHead();
+    }
+    ASSERT_EQUALS(list.capacity(), 512);
+}
+TEST_END()
+
+TEST_BEGIN(array_list_shrink_to_fit)
+{
+    int elements [40];
+    ArrayList<int> list;
+    list.reserve(256);
+    for (int i = 0; i < 40; i++) {
+        list.addTail(&elements[i]);
+    }
+    list.shrinkToFit();
+    ASSERT_EQUALS(list.capacity(), 40);
+    for (int i = 0; i < 40; i++) {
+        ASSERT_EQUALS(list.get(i), &elements[i]);
+    }
+    // the reservation is released, so the capacity follows the policy again
+    list.addTail(&elements[0]);
+    ASSERT_EQUALS(list.capacity(), 80);
+    for (int i = 0; i < 41; i++) {
+        list.removeTail();
+    }
+    ASSERT_EQUALS(list.capacity(), 16);
+}
+TEST_END()
+
+TEST_BEGIN(array_list_does_not_shrink_while_size_hovers)
+{
+    int elements [65];
+    ArrayList<int> list;
+    for (int i = 0; i < 65; i++) {
+        list.addTail(&elements[i]);
+    }
+    ASSERT_EQUALS(list.capacity(), 128);
+    for (int round = 0; round < 10; round++) {
+        list.removeTail();
+        list.removeTail();
+        list.addTail(&elements[0]);
+        list.addTail(&elements[0]);
+        ASSERT_EQUALS(list.capacity(), 128);
+    }
+    // shrinks only when less than a quarter is used
+    while (list.size() > 32) {
+        list.removeTail();
+    }
+    ASSERT_EQUALS(list.capacity(), 128);
+    list.removeTail();
+    ASSERT_EQUALS(list.capacity(), 64);
+}
+TEST_END()
+
+TEST_BEGIN(array_list_remove_if_shrinks_at_quarter)
+{
+    int elements [256];
+    ArrayList<int> list;
+    for (int i = 0; i < 256; i++) {
+        list.addTail(&elements[i]);
+    }
+    ASSERT_EQUALS(list.capacity(), 256);
+    list.removeIf([](int *element) { return element != nullptr; });
+    ASSERT_TRUE(list.isEmpty());
+    ASSERT_EQUALS(list.capacity(), 16);
+}
+TEST_END()
+
+namespace {
+    struct ExactPolicy {
+        static size_t grow(const size_t capacity, const size_t required) {
+            return (capacity < required) ? required : capacity;
+        }
+
+        static size_t shrink(const size_t capacity, const size_t count) {
+            return (count > 0) ? count : 1;
+        }
+    };
+
+    // shrinks to 0 when the list becomes empty, and never grows by itself
+    struct CountPolicy {
+        static size_t grow(const size_t capacity, const size_t) {
+            return capacity;
+        }
+
+        static size_t shrink(const size_t, const size_t count) {
+            return count;
+        }
+    };
+}
+
+TEST_BEGIN(array_list_uses_given_policy)
+{
+    int elements [10];
+    ArrayList<int, ExactPolicy> list(1);
+    for (int i = 0; i < 10; i++) {
+        list.addTail(&elements[i]);
+        ASSERT_EQUALS(list.capacity(), (size_t)i + 1);
+    }
+    list.shrinkToFit();
+    list.removeTail();
+    ASSERT_EQUALS(list.capacity(), 9);
+    ASSERT_EQUALS(list.get(8), &elements[8]);
+}
+TEST_END()
+
+TEST_BEGIN(array_list_keeps_array_for_policy_shrinking_to_0)
+{
+    int elements [20];
+    ArrayList<int, CountPolicy> list(1);
+    for (int i = 0; i < 3; i++) {
+        list.addTail(&elements[i]);
+    }
+    ASSERT_EQUALS(list.capacity(), 3);
+    list.shrinkToFit();
+    for (int i = 0; i < 3; i++) {
+        list.removeTail();
+    }
+    ASSERT_TRUE(list.isEmpty());
+    ASSERT_EQUALS(list.capacity(), 1);
+    list.addTail(&elements[0]);
+    ASSERT_EQUALS(list.getHead(), &elements[0]);
+    int *pointers [20];
+    for (int i = 0; i < 20; i++) {
+        pointers[i] = &elements[i];
+    }
+    list.addAllTail(pointers, 20);
+    ASSERT_EQUALS(list.size(), 21);
+    ASSERT_EQUALS(list.capacity(), 21);
+    ASSERT_TRUE(list.removeRange(0, 21));
+    ASSERT_EQUALS(list.capacity(), 1);
+    list.addHead(&elements[5]);
+    list.removeIf([](int *) { return true; });
+    ASSERT_TRUE(list.isEmpty());
+    list.addTail(&elements[7]);
+    ASSERT_EQUALS(list.getTail(), &elements[7]);
+}
+TEST_END()
+
+const testfunc_t functions [] = {
+    test_array_list_has_default_capacity,
+    test_array_list_has_given_initial_capacity,
+    test_array_list_grows_from_zero_initial_capacity,
+    test_array_list_reserve_keeps_elements,
+    test_array_list_reserved_capacity_is_not_shrunk,
+    test_array_list_shrink_to_fit,
+    test_array_list_does_not_shrink_while_size_hovers,
+    test_array_list_remove_if_shrinks_at_quarter,
+    test_array_list_uses_given_policy,
+    test_array_list_keeps_array_for_policy_shrinking_to_0,
+};
+
+MAIN();
@@ -0,0 +1,248 @@
+/**
+ * @file testArrayVector.cpp - Tests for the array vector.
+ * 
+ * @copyright Copyright (c) 2025 YH Choi. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "../../test.h"
+#include "../../../src/structures/lists/ArrayVector.h"
+
+#include <iostream>
+
+using yh::structures::lists::ArrayVector;
+
+namespace {
+    int liveCount = 0;
+
+    // counts the live objects, so that every construction is matched by a destruction
+    struct Tracked {
+        int value;
+        Tracked(const int value) : value(value) { liveCount++; }
+        Tracked(const Tracked &other) : value(other.value) { liveCount++; }
+        Tracked(Tracked &&other) : value(other.value) { other.value = -1; liveCount++; }
+        Tracked &operator=(const Tracked &other) { value = other.value; return *this; }
+        Tracked &operator=(Tracked &&other) { value = other.value; other.value = -1; return *this; }
+        ~Tracked() { liveCount--; }
+    };
+
+    struct Point {
+        int x;
+        int y;
+        Point(const int x, const int y) : x(x), y(y) {}
+    };
+}
+
+TEST_BEGIN(vector_is_empty_for_empty_vector)
+{
+    ArrayVector<int> vector;
+    ASSERT_TRUE(vector.isEmpty());
+    ASSERT_EQUALS(vector.size(), 0);
+    ASSERT_EQUALS(vector.capacity(), 0);
+    ASSERT_IS_NULLPTR(vector.get(0));
+    ASSERT_FALSE(vector.removeTail());
+    ASSERT_FALSE(vector.remove(0));
+}
+TEST_END()
+
+TEST_BEGIN(vector_add_tail_and_get)
+{
+    ArrayVector<int> vector;
+    for (int i = 0; i < 100; i++) {
+        ASSERT_EQUALS(*vector.addTail(i * 3), i * 3);
+        ASSERT_EQUALS(vector.size(), (size_t)i + 1);
+    }
+    for (int i = 0; i < 100; i++) {
+        ASSERT_EQUALS(*vector.get(i), i * 3);
+        ASSERT_EQUALS(vector.data()[i], i * 3);
+    }
+    ASSERT_IS_NULLPTR(vector.get(100));
+}
+TEST_END()
+
+TEST_BEGIN(vector_emplace_back_constructs_in_place)
+{
+    ArrayVector<Point> vector;
+    Point *const point = vector.emplaceBack(3, -4);
+    ASSERT_EQUALS(point, vector.data());
+    ASSERT_EQUALS(point->x, 3);
+    ASSERT_EQUALS(point->y, -4);
+}
+TEST_END()
+
+TEST_BEGIN(vector_reserve_keeps_storage)
+{
+    ArrayVector<int> vector;
+    vector.reserve(50);
+    ASSERT_EQUALS(vector.capacity(), 50);
+    const int *const storage = vector.data();
+    for (int i = 0; i < 50; i++) {
+        vector.addTail(i);
+    }
+    ASSERT_EQUALS(vector.data(), storage);
+    vector.reserve(10);
+    ASSERT_EQUALS(vector.capacity(), 50);
+    vector.addTail(50);
+    ASSERT_NOT_EQUALS(vector.data(), storage);
+    for (int i = 0; i <= 50; i++) {
+        ASSERT_EQUALS(*vector.get(i), i);
+    }
+}
+TEST_END()
+
+TEST_BEGIN(vector_growth_moves_and_destroys_elements)
+{
+    {
+        ArrayVector<Tracked> vector;
+        for (int i = 0; i < 40; i++) {
+            vector.emplaceBack(i);
+            ASSERT_EQUALS(liveCount, i + 1);
+        }
+        for (int i = 0; i < 40; i++) {
+            ASSERT_EQUALS(vector.get(i)->value, i);
+        }
+    }
+    ASSERT_EQUALS(liveCount, 0);
+}
+TEST_END()
+
+TEST_BEGIN(vector_growth_relocates_trivially_copyable_elements)
+{
+    ArrayVector<Point> vector;
+    for (int i = 0; i < 1000; i++) {
+        vector.emplaceBack(i, -i);
+    }
+    ASSERT_EQUALS(vector.size(), 1000);
+    for (int i = 0; i < 1000; i++) {
+        ASSERT_EQUALS(vector.get(i)->x, i);
+        ASSERT_EQUALS(vector.get(i)->y, -i);
+    }
+}
+TEST_END()
+
+TEST_BEGIN(vector_add_own_element_while_full)
+{
+    ArrayVector<Tracked> vector;
+    vector.reserve(2);
+    vector.emplaceBack(7);
+    vector.emplaceBack(8);
+    vector.addTail(*vector.get(0));
+    ASSERT_EQUALS(vector.size(), 3);
+    ASSERT_EQUALS(vector.get(0)->value, 7);
+    ASSERT_EQUALS(vector.get(2)->value, 7);
+    vector.clear();
+    ASSERT_EQUALS(liveCount, 0);
+}
+TEST_END()
+
+TEST_BEGIN(vector_remove_keeps_order)
+{
+    ArrayVector<Tracked> vector;
+    for (int i = 0; i < 10; i++) {
+        vector.emplaceBack(i);
+    }
+    ASSERT_TRUE(vector.remove(3));
+    ASSERT_TRUE(vector.remove(0));
+    ASSERT_TRUE(vector.removeTail());
+    ASSERT_FALSE(vector.remove(7));
+    ASSERT_EQUALS(vector.size(), 7);
+    ASSERT_EQUALS(liveCount, 7);
+    const int expected [] = {1, 2, 4, 5, 6, 7, 8};
+    for (int i = 0; i < 7; i++) {
+        ASSERT_EQUALS(vector.get(i)->value, expected[i]);
+    }
+    vector.clear();
+    ASSERT_TRUE(vector.isEmpty());
+    ASSERT_EQUALS(liveCount, 0);
+}
+TEST_END()
+
+TEST_BEGIN(vector_move_constructor_takes_elements)
+{
+    ArrayVector<int> vector;
+    vector.addTail(1);
+    vector.addTail(2);
+    const int *const storage = vector.data();
+    ArrayVector<int> other(yh::utility::move(vector));
+    ASSERT_TRUE(vector.isEmpty());
+    ASSERT_IS_NULLPTR(vector.data());
+    ASSERT_EQUALS(other.size(), 2);
+    ASSERT_EQUALS(other.data(), storage);
+    ASSERT_EQUALS(*other.get(1), 2);
+}
+TEST_END()
+
+TEST_BEGIN(vector_move_assignment_replaces_elements)
+{
+    {
+        ArrayVector<Tracked> vector;
+        vector.emplaceBack(1);
+        vector.emplaceBack(2);
+        const Tracked *const storage = vector.data();
+        ArrayVector<Tracked> other;
+        for (int i = 0; i < 20; i++) {
+            other.emplaceBack(i);
+        }
+        ASSERT_EQUALS(liveCount, 22);
+        other = yh::utility::move(vector);
+        ASSERT_EQUALS(liveCount, 2);
+        ASSERT_TRUE(vector.isEmpty());
+        ASSERT_IS_NULLPTR(vector.data());
+        ASSERT_EQUALS(vector.capacity(), 0);
+        ASSERT_EQUALS(other.size(), 2);
+        ASSERT_EQUALS(other.data(), storage);
+        ASSERT_EQUALS(other.get(1)->value, 2);
+
+        // moving into itself keeps the elements
+        ArrayVector<Tracked> &self = other;
+        other = yh::utility::move(self);
+        ASSERT_EQUALS(other.size(), 2);
+        ASSERT_EQUALS(other.data(), storage);
+        ASSERT_EQUALS(liveCount, 2);
+
+        // the moved-from vector can be reused
+        vector.emplaceBack(3);
+        ASSERT_EQUALS(vector.get(0)->value, 3);
+    }
+    ASSERT_EQUALS(liveCount, 0);
+}
+TEST_END()
+
+const testfunc_t functions [] = {
+    test_vector_is_empty_for_empty_vector,
+    test_vector_add_tail_and_get,
+    test_vector_emplace_back_constructs_in_place,
+    test_vector_reserve_keeps_storage,
+    test_vector_growth_moves_and_destroys_elements,
+    test_vector_growth_relocates_trivially_copyable_elements,
+    test_vector_add_own_element_while_full,
+    test_vector_remove_keeps_order,
+    test_vector_move_constructor_takes_elements,
+    test_vector_move_assignment_replaces_elements,
+};
+
+MAIN();
@@ -0,0 +1,372 @@
+/**
+ * @file test_functional.cpp - Tests for comparators and key projections of sorts.
+ * 
+ * @copyright Copyright (c) 2025 YH Choi. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "../test.h"
+#include "../../src/utility/functional.h"
+#include "../../src/algo/sort/cached_key_sort.h"
+#include "../../src/algo/sort/heap_sort.h"
+#include "../../src/algo/sort/insertion_sort.h"
+#include "../../src/algo/sort/merge_sort.h"
+#include "../../src/algo/sort/nth_element.h"
+#include "../../src/algo/sort/parallel_merge_sort.h"
+#include "../../src/algo/sort/partial_sort.h"
+#include "../../src/algo/sort/pdq_sort.h"
+#include "../../src/algo/sort/quick_sort.h"
+#include "../../src/algo/sort/selection_sort.h"
+#include "../../src/algo/sort/sort.h"
+#include "../../src/algo/sort/sorting_network.h"
+#include "../../src/algo/sort/tim_sort.h"
+
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <sstream>
+
+namespace {
+    const size_t LENGTH = 300;
+
+    void fill(int *const elements) {
+        for (size_t i = 0; i < LENGTH; i++) {
+            elements[i] = (int)((i * 7919) % LENGTH);
+        }
+    }
+
+    bool is_descending(const int *const elements) {
+        for (size_t i = 0; i < LENGTH; i++) {
+            if (elements[i] != (int)(LENGTH - 1 - i)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief A record sorted by its key, remembering its original position.
+     */
+    struct Record {
+        int key;
+        size_t position;
+    };
+
+    void fill(Record *const records) {
+        for (size_t i = 0; i < LENGTH; i++) {
+            records[i].key = (int)((i * 7919) % 17);
+            records[i].position = i;
+        }
+    }
+
+    bool is_stably_sorted(const Record *const records) {
+        for (size_t i = 1; i < LENGTH; i++) {
+            if (records[i - 1].key > records[i].key) {
+                return false;
+            }
+            if (records[i - 1].key == records[i].key && records[i - 1].position > records[i].position) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief A projection counting how many times it is called.
+     */
+    struct CountingKey {
+        size_t *calls;
+
+        int operator()(const Record &record) const {
+            ++(*calls);
+            return record.key;
+        }
+    };
+}
+
+TEST_BEGIN(less_and_greater)
+{
+    ASSERT_TRUE(yh::utility::Less()(1, 2));
+    ASSERT_FALSE(yh::utility::Less()(2, 2));
+    ASSERT_TRUE(yh::utility::Greater()(2, 1));
+    ASSERT_FALSE(yh::utility::Greater()(2, 2));
+}
+TEST_END()
+
+TEST_BEGIN(insertion_sort_descending)
+{
+    int elements [LENGTH];
+    fill(elements);
+    yh::algo::sort::insertion_sort(elements, 0, LENGTH, yh::utility::Greater());
+    ASSERT_TRUE(is_descending(elements));
+}
+TEST_END()
+
+TEST_BEGIN(selection_sort_descending)
+{
+    int elements [LENGTH];
+    fill(elements);
+    yh::algo::sort::selection_sort(elements, 0, LENGTH, yh::utility::Greater());
+    ASSERT_TRUE(is_descending(elements));
+}
+TEST_END()
+
+TEST_BEGIN(heap_sort_descending)
+{
+    int elements [LENGTH];
+    fill(elements);
+    yh::algo::sort::heap_sort(elements, 0, LENGTH, yh::utility::Greater());
+    ASSERT_TRUE(is_descending(elements));
+}
+TEST_END()
+
+TEST_BEGIN(quick_sort_descending)
+{
+    int elements [LENGTH];
+    fill(elements);
+    yh::algo::sort::quick_sort(elements, 0, LENGTH, yh::utility::Greater());
+    ASSERT_TRUE(is_descending(elements));
+}
+TEST_END()
+
+TEST_BEGIN(merge_sort_descending)
+{
+    int elements [LENGTH];
+    fill(elements);
+    yh::algo::sort::merge_sort(elements, 0, LENGTH, yh::utility::Greater());
+    ASSERT_TRUE(is_descending(elements));
+}
+TEST_END()
+
+TEST_BEGIN(parallel_merge_sort_descending)
+{
+    int elements [LENGTH];
+    fill(elements);
+    yh::algo::sort::parallel_merge_sort(elements, 0, LENGTH, 0, 16, yh::utility::Greater());
+    ASSERT_TRUE(is_descending(elements));
+}
+TEST_END()
+
+TEST_BEGIN(pdq_sort_descending)
+{
+    int elements [LENGTH];
+    fill(elements);
+    yh::algo::sort::pdq_sort(elements, 0, LENGTH, yh::utility::Greater());
+    ASSERT_TRUE(is_descending(elements));
+}
+TEST_END()
+
+TEST_BEGIN(tim_sort_descending)
+{
+    int elements [LENGTH];
+    fill(elements);
+    yh::algo::sort::tim_sort(elements, 0, LENGTH, yh::utility::Greater());
+    ASSERT_TRUE(is_descending(elements));
+}
+TEST_END()
+
+TEST_BEGIN(sort_descending)
+{
+    int elements [LENGTH];
+    fill(elements);
+    yh::algo::sort::sort(elements, 0, LENGTH, yh::utility::Greater());
+    ASSERT_TRUE(is_descending(elements));
+}
+TEST_END()
+
+TEST_BEGIN(stable_sort_by_field_is_stable)
+{
+    Record records [LENGTH];
+    fill(records);
+    yh::algo::sort::stable_sort(records, 0, LENGTH, yh::utility::by_key([](const Record &record) { return record.key; }));
+    ASSERT_TRUE(is_stably_sorted(records));
+}
+TEST_END()
+
+TEST_BEGIN(stable_sort_keeps_order_of_signed_zeros)
+{
+    // long enough for radix sort, with random values in between so that the array does not look presorted
+    static const int ZERO_LENGTH = 2000;
+    double elements [ZERO_LENGTH * 2];
+    unsigned int state = 1;
+    for (int i = 0; i < ZERO_LENGTH; i++) {
+        state = state * 1103515245U + 12345U;
+        elements[i * 2] = (i % 2 == 0) ? 0.0 : -0.0;
+        // the values in between are never 0, so that only the signed zeros compare equal to 0
+        elements[i * 2 + 1] = (double)(int)((state >> 16) % 100) - 49.5;
+    }
+    yh::algo::sort::stable_sort(elements, 0, ZERO_LENGTH * 2);
+    int zeroIndex = 0;
+    for (int i = 0; i < ZERO_LENGTH * 2; i++) {
+        if (i > 0) {
+            ASSERT_FALSE(elements[i] < elements[i - 1]);
+        }
+        if (elements[i] == 0.0 && zeroIndex < ZERO_LENGTH) {
+            ASSERT_EQUALS(std::signbit(elements[i]), zeroIndex % 2 != 0);
+            zeroIndex++;
+        }
+    }
+}
+TEST_END()
+
+TEST_BEGIN(sort_fixed_length_array)
+{
+    int elements [] = {3, 7, 1, 8, 5, 2, 6, 4};
+    yh::algo::sort::sort(elements);
+    for (int i = 0; i < 8; i++) {
+        ASSERT_EQUALS(elements[i], i + 1);
+    }
+    yh::algo::sort::sort(elements, yh::utility::Greater());
+    for (int i = 0; i < 8; i++) {
+        ASSERT_EQUALS(elements[i], 8 - i);
+    }
+}
+TEST_END()
+
+TEST_BEGIN(sort_n_descending)
+{
+    int elements [] = {3, 7, 1, 8, 5, 2, 6, 4};
+    yh::algo::sort::sort_n<8>(elements, yh::utility::Greater());
+    for (int i = 0; i < 8; i++) {
+        ASSERT_EQUALS(elements[i], 8 - i);
+    }
+}
+TEST_END()
+
+TEST_BEGIN(sort_n_ascending_beyond_small_lengths)
+{
+    int elements [40];
+    int defaulted [40];
+    for (int i = 0; i < 40; i++) {
+        elements[i] = 40 - i;
+        defaulted[i] = 40 - i;
+    }
+    yh::algo::sort::sort_n<40>(elements, yh::utility::Less());
+    yh::algo::sort::sort_n<40>(defaulted);
+    for (int i = 0; i < 40; i++) {
+        ASSERT_EQUALS(elements[i], i + 1);
+        ASSERT_EQUALS(defaulted[i], i + 1);
+    }
+}
+TEST_END()
+
+TEST_BEGIN(partial_sort_descending)
+{
+    int elements [LENGTH];
+    fill(elements);
+    yh::algo::sort::partial_sort(elements, 0, 10, LENGTH, yh::utility::Greater());
+    for (int i = 0; i < 10; i++) {
+        ASSERT_EQUALS(elements[i], (int)LENGTH - 1 - i);
+    }
+}
+TEST_END()
+
+TEST_BEGIN(nth_element_descending)
+{
+    int elements [LENGTH];
+    fill(elements);
+    yh::algo::sort::nth_element(elements, 0, 10, LENGTH, yh::utility::Greater());
+    ASSERT_EQUALS(elements[10], (int)LENGTH - 11);
+}
+TEST_END()
+
+TEST_BEGIN(merge_sort_by_field_is_stable)
+{
+    Record records [LENGTH];
+    fill(records);
+    yh::algo::sort::merge_sort(records, 0, LENGTH, yh::utility::by_key([](const Record &record) { return record.key; }));
+    ASSERT_TRUE(is_stably_sorted(records));
+}
+TEST_END()
+
+TEST_BEGIN(tim_sort_by_field_is_stable)
+{
+    Record records [LENGTH];
+    fill(records);
+    yh::algo::sort::tim_sort(records, 0, LENGTH, yh::utility::by_key([](const Record &record) { return record.key; }));
+    ASSERT_TRUE(is_stably_sorted(records));
+}
+TEST_END()
+
+TEST_BEGIN(pdq_sort_by_field_descending)
+{
+    Record records [LENGTH];
+    fill(records);
+    yh::algo::sort::pdq_sort(records, 0, LENGTH, yh::utility::by_key([](const Record &record) { return record.key; }, yh::utility::Greater()));
+    for (size_t i = 1; i < LENGTH; i++) {
+        ASSERT_TRUE(records[i - 1].key >= records[i].key);
+    }
+}
+TEST_END()
+
+TEST_BEGIN(cached_key_sort_computes_keys_once)
+{
+    Record records [LENGTH];
+    fill(records);
+    size_t calls = 0;
+    CountingKey key = { &calls };
+    yh::algo::sort::cached_key_sort(records, 0, LENGTH, key);
+    ASSERT_TRUE(is_stably_sorted(records));
+    ASSERT_EQUALS(calls, LENGTH);
+}
+TEST_END()
+
+TEST_BEGIN(cached_key_sort_descending)
+{
+    int elements [LENGTH];
+    fill(elements);
+    yh::algo::sort::cached_key_sort(elements, 0, LENGTH, [](const int element) { return -element; }, yh::utility::Less());
+    ASSERT_TRUE(is_descending(elements));
+}
+TEST_END()
+
+const testfunc_t functions [] = {
+    test_less_and_greater,
+    test_insertion_sort_descending,
+    test_selection_sort_descending,
+    test_heap_sort_descending,
+    test_quick_sort_descending,
+    test_merge_sort_descending,
+    test_parallel_merge_sort_descending,
+    test_pdq_sort_descending,
+    test_tim_sort_descending,
+    test_sort_descending,
+    test_stable_sort_by_field_is_stable,
+    test_stable_sort_keeps_order_of_signed_zeros,
+    test_sort_fixed_length_array,
+    test_sort_n_descending,
+    test_sort_n_ascending_beyond_small_lengths,
+    test_partial_sort_descending,
+    test_nth_element_descending,
+    test_merge_sort_by_field_is_stable,
+    test_tim_sort_by_field_is_stable,
+    test_pdq_sort_by_field_descending,
+    test_cached_key_sort_computes_keys_once,
+    test_cached_key_sort_descending,
+};
+
+MAIN();
@@ -0,0 +1,306 @@
+/**
+ * @file test_move.cpp - Tests for move, swap and relocation helpers.
+ * 
+ * @copyright Copyright (c) 2025 YH Choi. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "../test.h"
+#include "../../src/utility/move.h"
+#include "../../src/algo/sort/heap_sort.h"
+#include "../../src/algo/sort/insertion_sort.h"
+#include "../../src/algo/sort/merge_sort.h"
+#include "../../src/algo/sort/pdq_sort.h"
+#include "../../src/algo/sort/quick_sort.h"
+#include "../../src/algo/sort/selection_sort.h"
+#include "../../src/algo/sort/tim_sort.h"
+
+#include <iostream>
+#include <string>
+#include <sstream>
+
+namespace {
+    /**
+     * @brief An element counting how many times elements are copied.
+     */
+    struct CopyCounter {
+        static size_t copies;
+        int value;
+
+        CopyCounter() : value(0) {}
+        CopyCounter(const int value) : value(value) {}
+        CopyCounter(const CopyCounter &other) : value(other.value) { ++copies; }
+        CopyCounter(CopyCounter &&other) : value(other.value) {}
+        CopyCounter &operator=(const CopyCounter &other) { value = other.value; ++copies; return *this; }
+        CopyCounter &operator=(CopyCounter &&other) { value = other.value; return *this; }
+        bool operator<(const CopyCounter &other) const { return value < other.value; }
+    };
+
+    size_t CopyCounter::copies = 0;
+
+    const size_t LENGTH = 200;
+
+    void fill(CopyCounter *const elements) {
+        for (size_t i = 0; i < LENGTH; i++) {
+            elements[i].value = (int)((i * 7919) % LENGTH);
+        }
+        CopyCounter::copies = 0;
+    }
+
+    bool is_sorted(const CopyCounter *const elements) {
+        for (size_t i = 0; i < LENGTH; i++) {
+            if (elements[i].value != (int)i) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    struct NotTriviallyCopyable {
+        NotTriviallyCopyable() {}
+        NotTriviallyCopyable(const NotTriviallyCopyable &) {}
+    };
+
+    /**
+     * @brief An element counting how many elements are alive.
+     */
+    struct LiveCounter {
+        static int live;
+        int value;
+
+        LiveCounter(const int value) : value(value) { ++live; }
+        LiveCounter(const LiveCounter &other) : value(other.value) { ++live; }
+        LiveCounter(LiveCounter &&other) : value(other.value) { other.value = -1; ++live; }
+        ~LiveCounter() { --live; }
+    };
+
+    int LiveCounter::live = 0;
+}
+
+TEST_BEGIN(swap_exchanges_values)
+{
+    int a = 3;
+    int b = -7;
+    yh::utility::swap(a, b);
+    ASSERT_EQUALS(a, -7);
+    ASSERT_EQUALS(b, 3);
+}
+TEST_END()
+
+TEST_BEGIN(swap_does_not_copy)
+{
+    CopyCounter a(1);
+    CopyCounter b(2);
+    CopyCounter::copies = 0;
+    yh::utility::swap(a, b);
+    ASSERT_EQUALS(a.value, 2);
+    ASSERT_EQUALS(b.value, 1);
+    ASSERT_EQUALS(CopyCounter::copies, 0);
+}
+TEST_END()
+
+TEST_BEGIN(trivially_copyable_traits)
+{
+    ASSERT_TRUE(yh::utility::IsTriviallyCopyable<int>::VALUE);
+    ASSERT_TRUE(yh::utility::IsTriviallyCopyable<double>::VALUE);
+    ASSERT_TRUE(yh::utility::IsTriviallyCopyable<int *>::VALUE);
+    ASSERT_FALSE(yh::utility::IsTriviallyCopyable<CopyCounter>::VALUE);
+    ASSERT_FALSE(yh::utility::IsTriviallyCopyable<NotTriviallyCopyable>::VALUE);
+}
+TEST_END()
+
+TEST_BEGIN(move_forward_overlapping_trivially_copyable)
+{
+    int elements [] = {0, 1, 2, 3, 4, 5, 6, 7};
+    yh::utility::move_forward(elements + 2, elements, 6);
+    for (int i = 0; i < 6; i++) {
+        ASSERT_EQUALS(elements[i], i + 2);
+    }
+}
+TEST_END()
+
+TEST_BEGIN(move_backward_overlapping_trivially_copyable)
+{
+    int elements [] = {0, 1, 2, 3, 4, 5, 6, 7};
+    yh::utility::move_backward(elements, elements + 2, 6);
+    for (int i = 2; i < 8; i++) {
+        ASSERT_EQUALS(elements[i], i - 2);
+    }
+}
+TEST_END()
+
+TEST_BEGIN(move_forward_overlapping_does_not_copy)
+{
+    CopyCounter elements [8];
+    for (int i = 0; i < 8; i++) {
+        elements[i].value = i;
+    }
+    CopyCounter::copies = 0;
+    yh::utility::move_forward(elements + 2, elements, 6);
+    for (int i = 0; i < 6; i++) {
+        ASSERT_EQUALS(elements[i].value, i + 2);
+    }
+    ASSERT_EQUALS(CopyCounter::copies, 0);
+}
+TEST_END()
+
+TEST_BEGIN(move_backward_overlapping_does_not_copy)
+{
+    CopyCounter elements [8];
+    for (int i = 0; i < 8; i++) {
+        elements[i].value = i;
+    }
+    CopyCounter::copies = 0;
+    yh::utility::move_backward(elements, elements + 2, 6);
+    for (int i = 2; i < 8; i++) {
+        ASSERT_EQUALS(elements[i].value, i - 2);
+    }
+    ASSERT_EQUALS(CopyCounter::copies, 0);
+}
+TEST_END()
+
+TEST_BEGIN(relocate_trivially_copyable)
+{
+    int source [] = {5, -1, 7, 0, 3};
+    int destination [5];
+    yh::utility::relocate(source, destination, 5);
+    const int expected [] = {5, -1, 7, 0, 3};
+    for (int i = 0; i < 5; i++) {
+        ASSERT_EQUALS(destination[i], expected[i]);
+    }
+}
+TEST_END()
+
+TEST_BEGIN(relocate_constructs_and_destroys)
+{
+    LiveCounter *const source = static_cast<LiveCounter *>(::operator new(4 * sizeof(LiveCounter)));
+    LiveCounter *const destination = static_cast<LiveCounter *>(::operator new(4 * sizeof(LiveCounter)));
+    for (int i = 0; i < 4; i++) {
+        new (source + i) LiveCounter(i * 10);
+    }
+    yh::utility::relocate(source, destination, 4);
+    ASSERT_EQUALS(LiveCounter::live, 4);
+    for (int i = 0; i < 4; i++) {
+        ASSERT_EQUALS(destination[i].value, i * 10);
+        destination[i].~LiveCounter();
+    }
+    ASSERT_EQUALS(LiveCounter::live, 0);
+    ::operator delete(source);
+    ::operator delete(destination);
+}
+TEST_END()
+
+TEST_BEGIN(insertion_sort_does_not_copy)
+{
+    CopyCounter elements [LENGTH];
+    fill(elements);
+    yh::algo::sort::insertion_sort(elements, 0, LENGTH);
+    ASSERT_TRUE(is_sorted(elements));
+    ASSERT_EQUALS(CopyCounter::copies, 0);
+}
+TEST_END()
+
+TEST_BEGIN(selection_sort_does_not_copy)
+{
+    CopyCounter elements [LENGTH];
+    fill(elements);
+    yh::algo::sort::selection_sort(elements, 0, LENGTH);
+    ASSERT_TRUE(is_sorted(elements));
+    ASSERT_EQUALS(CopyCounter::copies, 0);
+}
+TEST_END()
+
+TEST_BEGIN(heap_sort_does_not_copy)
+{
+    CopyCounter elements [LENGTH];
+    fill(elements);
+    yh::algo::sort::heap_sort(elements, 0, LENGTH);
+    ASSERT_TRUE(is_sorted(elements));
+    ASSERT_EQUALS(CopyCounter::copies, 0);
+}
+TEST_END()
+
+TEST_BEGIN(quick_sort_does_not_copy)
+{
+    CopyCounter elements [LENGTH];
+    fill(elements);
+    yh::algo::sort::quick_sort(elements, 0, LENGTH);
+    ASSERT_TRUE(is_sorted(elements));
+    ASSERT_EQUALS(CopyCounter::copies, 0);
+}
+TEST_END()
+
+TEST_BEGIN(merge_sort_does_not_copy)
+{
+    CopyCounter elements [LENGTH];
+    fill(elements);
+    yh::algo::sort::merge_sort(elements, 0, LENGTH);
+    ASSERT_TRUE(is_sorted(elements));
+    ASSERT_EQUALS(CopyCounter::copies, 0);
+}
+TEST_END()
+
+TEST_BEGIN(pdq_sort_does_not_copy)
+{
+    CopyCounter elements [LENGTH];
+    fill(elements);
+    yh::algo::sort::pdq_sort(elements, 0, LENGTH);
+    ASSERT_TRUE(is_sorted(elements));
+    ASSERT_EQUALS(CopyCounter::copies, 0);
+}
+TEST_END()
+
+TEST_BEGIN(tim_sort_does_not_copy)
+{
+    CopyCounter elements [LENGTH];
+    fill(elements);
+    yh::algo::sort::tim_sort(elements, 0, LENGTH);
+    ASSERT_TRUE(is_sorted(elements));
+    ASSERT_EQUALS(CopyCounter::copies, 0);
+}
+TEST_END()
+
+const testfunc_t functions [] = {
+    test_swap_exchanges_values,
+    test_swap_does_not_copy,
+    test_trivially_copyable_traits,
+    test_move_forward_overlapping_trivially_copyable,
+    test_move_backward_overlapping_trivially_copyable,
+    test_move_forward_overlapping_does_not_copy,
+    test_move_backward_overlapping_does_not_copy,
+    test_relocate_trivially_copyable,
+    test_relocate_constructs_and_destroys,
+    test_insertion_sort_does_not_copy,
+    test_selection_sort_does_not_copy,
+    test_heap_sort_does_not_copy,
+    test_quick_sort_does_not_copy,
+    test_merge_sort_does_not_copy,
+    test_pdq_sort_does_not_copy,
+    test_tim_sort_does_not_copy,
+};
+
+MAIN();
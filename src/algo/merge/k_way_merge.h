@@ -0,0 +1,158 @@
+/**
+ * @file k_way_merge.h The k-way merge implementation in C++.
+ * 
+ * @copyright Copyright (c) 2025 YH Choi. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef YH_ALGO_MERGE_K_WAY_MERGE_H
+#define YH_ALGO_MERGE_K_WAY_MERGE_H
+
+#ifdef ARDUINO
+#include <stddef.h>
+#else
+#include <cstddef>
+#endif
+
+#include "../../utility/functional.h"
+#include "loser_tree.h"
+
+namespace yh {
+    namespace algo {
+        namespace merge {
+            namespace _k_way_merge {
+                /**
+                 * @brief Writes merged elements to consecutive slots of an array.
+                 */
+                template<typename T>
+                class ArraySink {
+                    private:
+                        T *position;
+
+                    public:
+                        explicit ArraySink(T *const output) : position(output) {}
+
+                        inline void operator()(const T &element) {
+                            *position = element;
+                            ++position;
+                        }
+                };
+
+                /**
+                 * @brief Passes all remaining elements of a source to a sink.
+                 */
+                template<typename Source, typename Sink>
+                inline void drain(Source &source, Sink &sink) {
+                    for (typename _loser_tree::HeadPointer<Source>::Type element = source.peek(); element != nullptr; element = source.peek()) {
+                        sink(*element);
+                        source.proceed();
+                    }
+                }
+            }
+            /**
+             * 3 or more sources are merged by a loser tree with log2(k) comparisons per element.
+             * 1 source is passed through without comparisons, and 2 sources are merged directly without a tree.
+             * Equal elements are taken from the source with the smaller index first, so the merge is stable.
+             * A source is any class with <code>const T *peek() const</code>, returning nullptr when exhausted,
+             * and <code>void proceed()</code>, e.g. <code>ArraySource</code>.
+             * @brief Merges sorted sources, streaming the merged elements to a sink.
+             * @param Source The type of sources of sorted elements.
+             * @param Sink The type of the sink, called as <code>sink(element)</code> with every element in merged order.
+             * @param sources The sources of sorted elements, which are all exhausted after this function returns.
+             * @param count The number of sources.
+             * @param sink The sink of merged elements.
+             * @param compare The comparator returning whether its first argument goes before its second.  It is <code>operator&lt;</code> by default.
+             */
+            template<typename Source, typename Sink, typename Compare = utility::Less>
+            void k_way_merge(Source *const sources, const size_t count, Sink sink, Compare compare = Compare()) {
+                if (count == 0) {
+                    return;
+                }
+                if (count == 1) {
+                    _k_way_merge::drain(sources[0], sink);
+                    return;
+                }
+                if (count == 2) {
+                    typedef typename _loser_tree::HeadPointer<Source>::Type Pointer;
+                    Pointer lhs = sources[0].peek();
+                    Pointer rhs = sources[1].peek();
+                    while (lhs != nullptr && rhs != nullptr) {
+                        if (compare(*rhs, *lhs)) {
+                            sink(*rhs);
+                            sources[1].proceed();
+                            rhs = sources[1].peek();
+                        } else {
+                            sink(*lhs);
+                            sources[0].proceed();
+                            lhs = sources[0].peek();
+                        }
+                    }
+                    _k_way_merge::drain(sources[(lhs == nullptr) ? 1 : 0], sink);
+                    return;
+                }
+
+                LoserTree<Source, Compare> tree(sources, count, compare);
+                for (typename _loser_tree::HeadPointer<Source>::Type element = tree.top(); element != nullptr; element = tree.top()) {
+                    sink(*element);
+                    tree.pop();
+                }
+            }
+
+            /**
+             * 3 or more runs are merged by a loser tree with log2(k) comparisons per element.
+             * 1 run is copied, and 2 runs are merged directly without a tree.
+             * Equal elements are taken from the run with the smaller index first, so the merge is stable.
+             * @brief Merges sorted arrays into an array.
+             * @param T The type of elements to be merged.
+             * @param runs The first elements of the sorted arrays.
+             * @param lengths The numbers of elements of the sorted arrays.
+             * @param count The number of sorted arrays.
+             * @param output The array of at least the total length of all runs, which does not overlap with them.
+             * @param compare The comparator returning whether its first argument goes before its second.  It is <code>operator&lt;</code> by default.
+             * @return The number of elements written to <code>output</code>.
+             */
+            template<typename T, typename Compare = utility::Less>
+            size_t k_way_merge(const T *const *const runs, const size_t *const lengths, const size_t count, T *const output, Compare compare = Compare()) {
+                if (count == 0) {
+                    return 0;
+                }
+
+                size_t total = 0;
+                ArraySource<T> *const sources = new ArraySource<T>[count];
+                for (size_t i = 0; i < count; ++i) {
+                    sources[i] = ArraySource<T>(runs[i], lengths[i]);
+                    total += lengths[i];
+                }
+                k_way_merge(sources, count, _k_way_merge::ArraySink<T>(output), compare);
+                delete[] sources;
+                return total;
+            }
+        }
+    }
+}
+
+#endif // #ifndef YH_ALGO_MERGE_K_WAY_MERGE_H
@@ -0,0 +1,211 @@
+/**
+ * @file loser_tree.h The loser tree implementation in C++.
+ * 
+ * @copyright Copyright (c) 2025 YH Choi. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef YH_ALGO_MERGE_LOSER_TREE_H
+#define YH_ALGO_MERGE_LOSER_TREE_H
+
+#ifdef ARDUINO
+#include <stddef.h>
+#else
+#include <cstddef>
+#endif
+
+#include "../../utility/functional.h"
+
+namespace yh {
+    namespace algo {
+        namespace merge {
+            namespace _loser_tree {
+                /**
+                 * @brief The type of pointers returned by <code>Source::peek()</code>.
+                 */
+                template<typename Source>
+                struct HeadPointer {
+                    /**
+                     * @brief Declared only to name a source in the unevaluated operand below.
+                     */
+                    static Source &source();
+
+                    typedef decltype(source().peek()) Type;
+                };
+            }
+            /**
+             * This is a source of a loser tree reading a sorted array.
+             * @brief Reads the elements of a sorted array one by one.
+             * @param T The type of elements.
+             */
+            template<typename T>
+            class ArraySource {
+                private:
+                    const T *position;
+                    const T *end;
+
+                public:
+                    ArraySource() : position(nullptr), end(nullptr) {}
+
+                    /**
+                     * @param elements The first element of the sorted array.
+                     * @param length The number of elements in the sorted array.
+                     */
+                    ArraySource(const T *const elements, const size_t length) : position(elements), end(elements + length) {}
+
+                    /**
+                     * @brief Gets the next element without consuming it.
+                     * @return The next element, or nullptr if there is no more element.
+                     */
+                    const T *peek() const {
+                        return (position < end) ? position : nullptr;
+                    }
+
+                    /**
+                     * @brief Consumes the next element.
+                     */
+                    void proceed() {
+                        ++position;
+                    }
+            };
+
+            /**
+             * Each internal node keeps the loser of the match below it and the overall winner is kept at node 0,
+             * so replacing the winner replays only the matches on its path: log2(k) comparisons per element,
+             * each against a cached pointer to the head of a source.
+             * Ties are won by the source with the smaller index, so merging with this tree is stable.
+             * A source is any class with <code>const T *peek() const</code>, returning nullptr when exhausted,
+             * and <code>void proceed()</code>, e.g. <code>ArraySource</code>.
+             * @brief A tournament tree of losers selecting the source with the least next element.
+             * @param Source The type of sources of sorted elements.
+             * @param Compare The type of the comparator of elements.
+             */
+            template<typename Source, typename Compare = utility::Less>
+            class LoserTree {
+                private:
+                    typedef typename _loser_tree::HeadPointer<Source>::Type Pointer;
+
+                    Source *const sources;
+                    const size_t count;
+                    size_t *const tree;
+                    Pointer *const heads;
+                    const Compare compare;
+
+                    /**
+                     * The index <code>count</code> is a sentinel beating every source, used while building the tree.
+                     * Exhausted sources lose to every other source.
+                     */
+                    bool beats(const size_t lhs, const size_t rhs) const {
+                        if (lhs == count) {
+                            return true;
+                        }
+                        if (rhs == count) {
+                            return false;
+                        }
+                        const Pointer lhsHead = heads[lhs];
+                        const Pointer rhsHead = heads[rhs];
+                        if (lhsHead == nullptr) {
+                            return false;
+                        }
+                        if (rhsHead == nullptr) {
+                            return true;
+                        }
+                        if (compare(*lhsHead, *rhsHead)) {
+                            return true;
+                        }
+                        return lhs < rhs && !compare(*rhsHead, *lhsHead);
+                    }
+
+                    /**
+                     * @brief Replays the matches from a leaf to the root.
+                     */
+                    void replay(size_t winner) {
+                        for (size_t node = (winner + count) / 2; node > 0; node /= 2) {
+                            if (beats(tree[node], winner)) {
+                                const size_t loser = winner;
+                                winner = tree[node];
+                                tree[node] = loser;
+                            }
+                        }
+                        tree[0] = winner;
+                    }
+
+                public:
+                    /**
+                     * @param sources The sources of sorted elements, which must outlive this tree.
+                     * @param count The number of sources, at least 1.
+                     * @param compare The comparator of elements.
+                     */
+                    LoserTree(Source *const sources, const size_t count, const Compare &compare = Compare())
+                        : sources(sources), count(count), tree(new size_t[count]), heads(new Pointer[count]), compare(compare) {
+                        for (size_t i = 0; i < count; ++i) {
+                            tree[i] = count;
+                            heads[i] = sources[i].peek();
+                        }
+                        for (size_t i = count; i > 0; --i) {
+                            replay(i - 1);
+                        }
+                    }
+
+                    LoserTree(const LoserTree &) = delete;
+                    LoserTree &operator=(const LoserTree &) = delete;
+
+                    ~LoserTree() {
+                        delete[] tree;
+                        delete[] heads;
+                    }
+
+                    /**
+                     * @brief Gets the least next element of all sources.
+                     * @return The least element, or nullptr if all sources are exhausted.
+                     */
+                    Pointer top() const {
+                        return heads[tree[0]];
+                    }
+
+                    /**
+                     * @brief Gets the index of the source holding the least next element.
+                     */
+                    size_t topSource() const {
+                        return tree[0];
+                    }
+
+                    /**
+                     * @brief Consumes the least next element.
+                     */
+                    void pop() {
+                        const size_t winner = tree[0];
+                        sources[winner].proceed();
+                        heads[winner] = sources[winner].peek();
+                        replay(winner);
+                    }
+            };
+        }
+    }
+}
+
+#endif // #ifndef YH_ALGO_MERGE_LOSER_TREE_H
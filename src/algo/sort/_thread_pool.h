@@ -0,0 +1,267 @@
+/**
+ * @file _thread_pool.h A minimal pthread-backed thread pool shared by the parallel sorting algorithms.
+ * 
+ * @copyright Copyright (c) 2025 YH Choi. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef YH_ALGO_SORT__THREAD_POOL_H
+#define YH_ALGO_SORT__THREAD_POOL_H
+
+#ifndef ARDUINO
+
+#include <cstddef>
+
+#include <pthread.h>
+#include <unistd.h>
+
+namespace yh {
+    namespace algo {
+        namespace sort {
+            namespace _thread_pool {
+                /**
+                 * @brief Gets the number of processors online.
+                 * @return The number of processors online, at least 1.
+                 */
+                inline size_t hardware_concurrency() {
+                    const long processors = sysconf(_SC_NPROCESSORS_ONLN);
+                    return (processors > 0) ? (size_t)processors : 1U;
+                }
+
+                /**
+                 * The thread calling <code>run()</code> works on the tasks too,
+                 * so a pool of size <code>n</code> only spawns <code>n - 1</code> workers.
+                 * @brief A fixed-size pool of threads running batches of tasks.
+                 */
+                class ThreadPool {
+                    private:
+                        /**
+                         * @brief The worker threads.
+                         */
+                        pthread_t *workers;
+
+                        /**
+                         * @brief The number of worker threads successfully spawned.
+                         */
+                        size_t workerCount;
+
+                        /**
+                         * @brief The mutex guarding all the states below.
+                         */
+                        pthread_mutex_t mutex;
+
+                        /**
+                         * @brief Signalled when a new batch is available or the pool is stopping.
+                         */
+                        pthread_cond_t batchAvailable;
+
+                        /**
+                         * @brief Signalled when all tasks of the batch are done.
+                         */
+                        pthread_cond_t batchDone;
+
+                        /**
+                         * @brief The function running a task of the batch.
+                         */
+                        void (*taskFunction)(void *, size_t);
+
+                        /**
+                         * @brief The context passed to the task function.
+                         */
+                        void *taskContext;
+
+                        /**
+                         * @brief The number of tasks in the batch.
+                         */
+                        size_t taskCount;
+
+                        /**
+                         * @brief The index of the next task to be claimed.
+                         */
+                        size_t nextTask;
+
+                        /**
+                         * @brief The number of tasks done.
+                         */
+                        size_t doneCount;
+
+                        /**
+                         * @brief The serial number of the batch, so that workers can tell a new batch.
+                         */
+                        unsigned long batch;
+
+                        /**
+                         * @brief Whether the workers should exit.
+                         */
+                        bool stopping;
+
+                        ThreadPool(const ThreadPool &) = delete;
+                        ThreadPool &operator=(const ThreadPool &) = delete;
+
+                        /**
+                         * @brief Claims and runs tasks until none is left.  The mutex must be locked.
+                         */
+                        void drain() {
+                            while (nextTask < taskCount) {
+                                const size_t task = nextTask;
+                                ++nextTask;
+                                pthread_mutex_unlock(&mutex);
+                                taskFunction(taskContext, task);
+                                pthread_mutex_lock(&mutex);
+                                ++doneCount;
+                                if (doneCount == taskCount) {
+                                    pthread_cond_signal(&batchDone);
+                                }
+                            }
+                        }
+
+                        /**
+                         * @brief The main loop of a worker.
+                         */
+                        void work() {
+                            unsigned long seenBatch = 0;
+                            pthread_mutex_lock(&mutex);
+                            while (true) {
+                                while (!stopping && batch == seenBatch) {
+                                    pthread_cond_wait(&batchAvailable, &mutex);
+                                }
+                                if (stopping) {
+                                    break;
+                                }
+                                seenBatch = batch;
+                                drain();
+                            }
+                            pthread_mutex_unlock(&mutex);
+                        }
+
+                        static void *workerMain(void *const pool) {
+                            static_cast<ThreadPool *>(pool)->work();
+                            return nullptr;
+                        }
+
+                        template<typename Task>
+                        static void runTask(void *const tasks, const size_t index) {
+                            static_cast<Task *>(tasks)[index]();
+                        }
+
+                    public:
+                        /**
+                         * @brief Creates a thread pool.
+                         * @param threadCount The number of threads including the caller of <code>run()</code>.
+                         */
+                        ThreadPool(const size_t threadCount) :
+                            workers((threadCount > 1) ? new pthread_t [threadCount - 1] : nullptr),
+                            workerCount(0),
+                            taskFunction(nullptr),
+                            taskContext(nullptr),
+                            taskCount(0),
+                            nextTask(0),
+                            doneCount(0),
+                            batch(0),
+                            stopping(false)
+                        {
+                            pthread_mutex_init(&mutex, nullptr);
+                            pthread_cond_init(&batchAvailable, nullptr);
+                            pthread_cond_init(&batchDone, nullptr);
+                            for (size_t i = 1; i < threadCount; ++i) {
+                                if (pthread_create(workers + workerCount, nullptr, workerMain, this) != 0) {
+                                    break; // carry on with fewer threads
+                                }
+                                ++workerCount;
+                            }
+                        }
+
+                        /**
+                         * @brief Stops and joins all workers.
+                         */
+                        ~ThreadPool() {
+                            pthread_mutex_lock(&mutex);
+                            stopping = true;
+                            pthread_cond_broadcast(&batchAvailable);
+                            pthread_mutex_unlock(&mutex);
+                            for (size_t i = 0; i < workerCount; ++i) {
+                                pthread_join(workers[i], nullptr);
+                            }
+                            delete[] workers;
+                            pthread_cond_destroy(&batchDone);
+                            pthread_cond_destroy(&batchAvailable);
+                            pthread_mutex_destroy(&mutex);
+                        }
+
+                        /**
+                         * @brief Gets the number of threads including the caller of <code>run()</code>.
+                         * @return The number of threads.
+                         */
+                        size_t size() {
+                            return workerCount + 1;
+                        }
+
+                        /**
+                         * Tasks are claimed one by one, so uneven tasks are balanced among the threads.
+                         * @brief Runs a batch of tasks and waits for all of them to be done.
+                         * @param function The function running a task, called as <code>function(context, index)</code>.
+                         * @param context The context passed to the function.
+                         * @param count The number of tasks, indexed [ 0 : count ).
+                         */
+                        void run(void (*function)(void *, size_t), void *const context, const size_t count) {
+                            if (count == 0) {
+                                return;
+                            }
+                            pthread_mutex_lock(&mutex);
+                            taskFunction = function;
+                            taskContext = context;
+                            taskCount = count;
+                            nextTask = 0;
+                            doneCount = 0;
+                            ++batch;
+                            pthread_cond_broadcast(&batchAvailable);
+                            drain();
+                            while (doneCount < taskCount) {
+                                pthread_cond_wait(&batchDone, &mutex);
+                            }
+                            pthread_mutex_unlock(&mutex);
+                        }
+
+                        /**
+                         * @brief Runs a batch of tasks and waits for all of them to be done.
+                         * @param Task The type of tasks, which are called as <code>tasks[i]()</code>.
+                         * @param tasks The array of tasks.
+                         * @param count The number of tasks.
+                         */
+                        template<typename Task>
+                        void run(Task *const tasks, const size_t count) {
+                            run(&runTask<Task>, tasks, count);
+                        }
+                };
+            }
+        }
+    }
+}
+
+#endif // #ifndef ARDUINO
+
+#endif // #ifndef YH_ALGO_SORT__THREAD_POOL_H
\ No newline at end of file
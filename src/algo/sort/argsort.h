@@ -0,0 +1,135 @@
+/**
+ * @file argsort.h The indirect sort implementation in C++.
+ * 
+ * @copyright Copyright (c) 2025 YH Choi. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef YH_ALGO_SORT_ARGSORT_H
+#define YH_ALGO_SORT_ARGSORT_H
+
+#ifdef ARDUINO
+#include <stddef.h>
+#else
+#include <cstddef>
+#endif
+
+#include "../../utility/functional.h"
+#include "../../utility/move.h"
+#include "merge_sort.h"
+
+namespace yh {
+    namespace algo {
+        namespace sort {
+            namespace _argsort {
+                /**
+                 * @brief Compares 2 indices by the elements they refer to.
+                 */
+                template<typename T, typename Compare>
+                class IndexCompare {
+                    private:
+                        const T *const elements;
+                        const Compare &compare;
+
+                    public:
+                        IndexCompare(const T *const elements, const Compare &compare) : elements(elements), compare(compare) {}
+
+                        template<typename Index>
+                        inline bool operator()(const Index lhs, const Index rhs) const {
+                            return compare(elements[lhs], elements[rhs]);
+                        }
+                };
+            }
+            /**
+             * Only the indices are moved, so this suits elements which are expensive to move.
+             * After this function returns, <code>elements[indices[0]], elements[indices[1]], ...</code> is sorted,
+             * and <code>apply_permutation</code> can move every element to its sorted position at most once.
+             * The indices are sorted with merge sort, so elements which are equal keep their relative order.
+             * @brief Sorts the indices of an array by the elements they refer to, without moving the elements.
+             * @param T The type of elements to be sorted.
+             * @param Index The type of indices, e.g. <code>uint32_t</code> or <code>size_t</code>, which must be able to hold <code>end - 1</code>.
+             * @param elements The array of elements to be sorted, which is not modified.
+             * @param start The index of the first element to be sorted.
+             * @param end The index of the first element not to be sorted after <code>start</code>.
+             * @param indices The array of at least <code>end - start</code> indices, which are overwritten with the indices of the elements in sorted order.
+             * @param compare The comparator returning whether its first argument goes before its second.  It is <code>operator&lt;</code> by default.
+             */
+            template<typename T, typename Index, typename Compare = utility::Less>
+            inline void argsort(const T *const elements, const size_t start, const size_t end, Index *const indices, Compare compare = Compare()) {
+                if (start >= end) {
+                    return;
+                }
+
+                const size_t length = end - start;
+                for (size_t i = 0; i < length; ++i) {
+                    indices[i] = (Index)(start + i);
+                }
+                merge_sort(indices, 0, length, _argsort::IndexCompare<T, Compare>(elements, compare));
+            }
+
+            /**
+             * The permutation is followed cycle by cycle, so every element is moved once plus once more per cycle,
+             * and no extra memory is used.  The indices are marked as done while being followed,
+             * so they hold <code>start, start + 1, ...</code> after this function returns.
+             * @brief Rearranges an array in place so that the element at <code>indices[i]</code> moves to <code>start + i</code>.
+             * @param T The type of elements to be rearranged.
+             * @param Index The type of indices.
+             * @param elements The array of elements to be rearranged.  This same array will be rearranged after this function returns.
+             * @param start The index of the first element to be rearranged.
+             * @param end The index of the first element not to be rearranged after <code>start</code>.
+             * @param indices The permutation of <code>[ start : end )</code> of <code>end - start</code> indices, e.g. the output of <code>argsort</code>.
+             */
+            template<typename T, typename Index>
+            inline void apply_permutation(T *const elements, const size_t start, const size_t end, Index *const indices) {
+                if (start >= end) {
+                    return;
+                }
+
+                const size_t length = end - start;
+                for (size_t i = 0; i < length; ++i) {
+                    if ((size_t)indices[i] == start + i) {
+                        continue;
+                    }
+
+                    // the element at the head of the cycle is displaced first, and fills the last hole
+                    T displaced = utility::move(elements[start + i]);
+                    size_t hole = i;
+                    while ((size_t)indices[hole] != start + i) {
+                        const size_t next = (size_t)indices[hole] - start;
+                        elements[start + hole] = utility::move(elements[start + next]);
+                        indices[hole] = (Index)(start + hole);
+                        hole = next;
+                    }
+                    elements[start + hole] = utility::move(displaced);
+                    indices[hole] = (Index)(start + hole);
+                }
+            }
+        }
+    }
+}
+
+#endif // #ifndef YH_ALGO_SORT_ARGSORT_H
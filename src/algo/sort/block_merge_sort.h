@@ -0,0 +1,601 @@
+/**
+ * @file block_merge_sort.h The in-place stable block merge sort implementation in C++.
+ * 
+ * @copyright Copyright (c) 2025 YH Choi. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef YH_ALGO_SORT_BLOCK_MERGE_SORT_H
+#define YH_ALGO_SORT_BLOCK_MERGE_SORT_H
+
+#ifdef ARDUINO
+#include <stddef.h>
+#else
+#include <cstddef>
+#endif
+
+#include "../../utility/functional.h"
+#include "../../utility/move.h"
+#include "insertion_sort.h"
+
+namespace yh {
+    namespace algo {
+        namespace sort {
+            namespace _block_merge_sort {
+                /**
+                 * @brief Ranges shorter than this are sorted with insertion sort.
+                 */
+                static const ptrdiff_t INSERTION_SORT_THRESHOLD = 16;
+
+                /**
+                 * Offsets are signed in this file, because the internal buffer sits right before the runs it merges.
+                 * @brief Swaps 2 non-overlapping ranges of elements.
+                 */
+                template<typename T>
+                inline void swap_n(T *const lhs, T *const rhs, const ptrdiff_t count) {
+                    for (ptrdiff_t i = 0; i < count; ++i) {
+                        utility::swap(lhs[i], rhs[i]);
+                    }
+                }
+
+                /**
+                 * @brief Exchanges 2 adjacent ranges of <code>lhsLength</code> and <code>rhsLength</code> elements with block swaps.
+                 */
+                template<typename T>
+                inline void rotate(T *elements, ptrdiff_t lhsLength, ptrdiff_t rhsLength) {
+                    while (lhsLength > 0 && rhsLength > 0) {
+                        if (lhsLength <= rhsLength) {
+                            swap_n(elements, elements + lhsLength, lhsLength);
+                            elements += lhsLength;
+                            rhsLength -= lhsLength;
+                        } else {
+                            swap_n(elements + (lhsLength - rhsLength), elements + lhsLength, rhsLength);
+                            lhsLength -= rhsLength;
+                        }
+                    }
+                }
+
+                /**
+                 * @brief Finds the first element of a sorted range not less than a key.
+                 */
+                template<typename T, typename Compare>
+                inline ptrdiff_t lower_bound(const T *const elements, const ptrdiff_t length, const T &key, const Compare &compare) {
+                    ptrdiff_t low = 0;
+                    ptrdiff_t high = length;
+                    while (low < high) {
+                        const ptrdiff_t middle = low + (high - low) / 2;
+                        if (compare(elements[middle], key)) {
+                            low = middle + 1;
+                        } else {
+                            high = middle;
+                        }
+                    }
+                    return low;
+                }
+
+                /**
+                 * @brief Finds the first element of a sorted range greater than a key.
+                 */
+                template<typename T, typename Compare>
+                inline ptrdiff_t upper_bound(const T *const elements, const ptrdiff_t length, const T &key, const Compare &compare) {
+                    ptrdiff_t low = 0;
+                    ptrdiff_t high = length;
+                    while (low < high) {
+                        const ptrdiff_t middle = low + (high - low) / 2;
+                        if (compare(key, elements[middle])) {
+                            high = middle;
+                        } else {
+                            low = middle + 1;
+                        }
+                    }
+                    return low;
+                }
+
+                /**
+                 * The keys are kept in order, and every other element is rotated past them, so the collection is stable.
+                 * @brief Collects up to <code>count</code> distinct elements at the front of an array.
+                 * @param elements The first element of the array.
+                 * @param length The number of elements in the array.
+                 * @param count The number of distinct elements wanted.
+                 * @param compare The comparator of elements.
+                 * @return The number of distinct elements collected.
+                 */
+                template<typename T, typename Compare>
+                ptrdiff_t collect_keys(T *const elements, const ptrdiff_t length, const ptrdiff_t count, const Compare &compare) {
+                    ptrdiff_t keys = 1;
+                    ptrdiff_t keysStart = 0;
+                    for (ptrdiff_t i = 1; i < length && keys < count; ++i) {
+                        const ptrdiff_t position = lower_bound(elements + keysStart, keys, elements[i], compare);
+                        if (position == keys || compare(elements[i], elements[keysStart + position])) {
+                            // move the keys next to the new key, then insert it
+                            rotate(elements + keysStart, keys, i - (keysStart + keys));
+                            keysStart = i - keys;
+                            rotate(elements + (keysStart + position), keys - position, 1);
+                            ++keys;
+                        }
+                    }
+                    rotate(elements, keysStart, keys);
+                    return keys;
+                }
+
+                /**
+                 * It takes O(min(lhsLength, rhsLength)^2 + lhsLength + rhsLength) time.
+                 * @brief Merges 2 adjacent sorted runs with rotations and no buffer.
+                 */
+                template<typename T, typename Compare>
+                void merge_without_buffer(T *elements, ptrdiff_t lhsLength, ptrdiff_t rhsLength, const Compare &compare) {
+                    if (lhsLength < rhsLength) {
+                        while (lhsLength > 0) {
+                            const ptrdiff_t count = lower_bound(elements + lhsLength, rhsLength, elements[0], compare);
+                            if (count != 0) {
+                                rotate(elements, lhsLength, count);
+                                elements += count;
+                                rhsLength -= count;
+                            }
+                            if (rhsLength == 0) {
+                                break;
+                            }
+                            do {
+                                ++elements;
+                                --lhsLength;
+                            } while (lhsLength > 0 && !compare(elements[lhsLength], elements[0]));
+                        }
+                    } else {
+                        while (rhsLength > 0) {
+                            const ptrdiff_t count = upper_bound(elements, lhsLength, elements[lhsLength + rhsLength - 1], compare);
+                            if (count != lhsLength) {
+                                rotate(elements + count, lhsLength - count, rhsLength);
+                                lhsLength = count;
+                            }
+                            if (lhsLength == 0) {
+                                break;
+                            }
+                            do {
+                                --rhsLength;
+                            } while (rhsLength > 0 && !compare(elements[lhsLength + rhsLength - 1], elements[lhsLength - 1]));
+                        }
+                    }
+                }
+
+                /**
+                 * The merged run ends up <code>-bufferOffset</code> elements earlier, and the buffer ends up after it.
+                 * @brief Merges 2 adjacent sorted runs forward into the buffer before them, swapping the buffer out.
+                 * @param elements The first element of the left run.
+                 * @param lhsLength The length of the left run.
+                 * @param rhsLength The length of the right run.
+                 * @param bufferOffset The offset of the buffer from <code>elements</code>, at most <code>-lhsLength</code>.
+                 * @param compare The comparator of elements.
+                 */
+                template<typename T, typename Compare>
+                void merge_left(T *const elements, const ptrdiff_t lhsLength, ptrdiff_t rhsLength, ptrdiff_t bufferOffset, const Compare &compare) {
+                    ptrdiff_t lhs = 0;
+                    ptrdiff_t rhs = lhsLength;
+                    rhsLength += lhsLength;
+                    while (rhs < rhsLength) {
+                        if (lhs == lhsLength || compare(elements[rhs], elements[lhs])) {
+                            utility::swap(elements[bufferOffset++], elements[rhs++]);
+                        } else {
+                            utility::swap(elements[bufferOffset++], elements[lhs++]);
+                        }
+                    }
+                    if (bufferOffset != lhs) {
+                        swap_n(elements + bufferOffset, elements + lhs, lhsLength - lhs);
+                    }
+                }
+
+                /**
+                 * @brief Merges 2 adjacent sorted runs backward into the buffer of <code>bufferLength</code> elements after them.
+                 */
+                template<typename T, typename Compare>
+                void merge_right(T *const elements, const ptrdiff_t lhsLength, const ptrdiff_t rhsLength, const ptrdiff_t bufferLength, const Compare &compare) {
+                    ptrdiff_t destination = lhsLength + rhsLength + bufferLength - 1;
+                    ptrdiff_t rhs = lhsLength + rhsLength - 1;
+                    ptrdiff_t lhs = lhsLength - 1;
+                    while (lhs >= 0) {
+                        if (rhs < lhsLength || compare(elements[rhs], elements[lhs])) {
+                            utility::swap(elements[destination--], elements[lhs--]);
+                        } else {
+                            utility::swap(elements[destination--], elements[rhs--]);
+                        }
+                    }
+                    if (rhs != destination) {
+                        while (rhs >= lhsLength) {
+                            utility::swap(elements[destination--], elements[rhs--]);
+                        }
+                    }
+                }
+
+                /**
+                 * <code>lhsOrigin</code> is 0 if the pending run came from the left run of the merge, otherwise 1,
+                 * and elements from the left run go first on ties.
+                 * @brief Merges the pending run with the next block through the buffer, leaving the rest of the one not exhausted.
+                 * @param elements The first element of the pending run, which has the buffer of <code>bufferLength</code> elements before it.
+                 * @param lhsLength The length of the pending run, set to the length of the rest.
+                 * @param lhsOrigin The origin of the pending run, set to the origin of the rest.
+                 * @param rhsLength The length of the next block.
+                 * @param bufferLength The length of the buffer.
+                 * @param compare The comparator of elements.
+                 */
+                template<typename T, typename Compare>
+                void merge_blocks_with_buffer(T *const elements, ptrdiff_t &lhsLength, int &lhsOrigin, const ptrdiff_t rhsLength, const ptrdiff_t bufferLength, const Compare &compare) {
+                    ptrdiff_t destination = -bufferLength;
+                    ptrdiff_t lhs = 0;
+                    ptrdiff_t rhs = lhsLength;
+                    ptrdiff_t lhsEnd = rhs;
+                    ptrdiff_t rhsEnd = rhs + rhsLength;
+                    const int rhsOrigin = 1 - lhsOrigin;
+                    while (lhs < lhsEnd && rhs < rhsEnd) {
+                        // the left run wins ties
+                        const bool takeLhs = (rhsOrigin == 0) ? compare(elements[lhs], elements[rhs]) : !compare(elements[rhs], elements[lhs]);
+                        if (takeLhs) {
+                            utility::swap(elements[destination++], elements[lhs++]);
+                        } else {
+                            utility::swap(elements[destination++], elements[rhs++]);
+                        }
+                    }
+                    if (lhs < lhsEnd) {
+                        lhsLength = lhsEnd - lhs;
+                        while (lhs < lhsEnd) {
+                            utility::swap(elements[--lhsEnd], elements[--rhsEnd]);
+                        }
+                    } else {
+                        lhsLength = rhsEnd - rhs;
+                        lhsOrigin = rhsOrigin;
+                    }
+                }
+
+                /**
+                 * @brief Merges the pending run with the next block with rotations, leaving the rest of the one not exhausted.
+                 */
+                template<typename T, typename Compare>
+                void merge_blocks_without_buffer(T *elements, ptrdiff_t &lhsLength, int &lhsOrigin, ptrdiff_t rhsLength, const Compare &compare) {
+                    if (rhsLength == 0) {
+                        return;
+                    }
+                    ptrdiff_t length = lhsLength;
+                    const int rhsOrigin = 1 - lhsOrigin;
+                    if (length > 0 && ((rhsOrigin == 0) ? !compare(elements[length - 1], elements[length]) : compare(elements[length], elements[length - 1]))) {
+                        while (length > 0) {
+                            const ptrdiff_t count = (rhsOrigin != 0) ? lower_bound(elements + length, rhsLength, elements[0], compare) : upper_bound(elements + length, rhsLength, elements[0], compare);
+                            if (count != 0) {
+                                rotate(elements, length, count);
+                                elements += count;
+                                rhsLength -= count;
+                            }
+                            if (rhsLength == 0) {
+                                lhsLength = length;
+                                return;
+                            }
+                            do {
+                                ++elements;
+                                --length;
+                            } while (length > 0 && ((rhsOrigin == 0) ? compare(elements[0], elements[length]) : !compare(elements[length], elements[0])));
+                        }
+                    }
+                    lhsLength = rhsLength;
+                    lhsOrigin = rhsOrigin;
+                }
+
+                /**
+                 * The blocks are already in the order of their first elements, and the keys tell which run each block came from.
+                 * @brief Merges a sequence of blocks, each of which is sorted, followed by a shorter sorted tail.
+                 * @param keys The keys of the blocks.
+                 * @param middleKey The key of the first block of the right run.
+                 * @param elements The first element of the first block.
+                 * @param blockCount The number of blocks to be merged as blocks.
+                 * @param blockLength The length of a block.
+                 * @param hasBuffer Whether the buffer of <code>blockLength</code> elements is before <code>elements</code>.
+                 * @param tailBlockCount The number of blocks of the left run which go after the tail.
+                 * @param tailLength The length of the tail from the right run.
+                 * @param compare The comparator of elements.
+                 */
+                template<typename T, typename Compare>
+                void merge_block_sequence(const T *const keys, const T *const middleKey, T *const elements, const ptrdiff_t blockCount, const ptrdiff_t blockLength,
+                    const bool hasBuffer, const ptrdiff_t tailBlockCount, const ptrdiff_t tailLength, const Compare &compare) {
+                    if (blockCount == 0) {
+                        const ptrdiff_t length = tailBlockCount * blockLength;
+                        if (hasBuffer) {
+                            merge_left(elements, length, tailLength, -blockLength, compare);
+                        } else {
+                            merge_without_buffer(elements, length, tailLength, compare);
+                        }
+                        return;
+                    }
+
+                    ptrdiff_t restLength = blockLength;
+                    int restOrigin = compare(keys[0], *middleKey) ? 0 : 1;
+                    ptrdiff_t blockStart = blockLength;
+                    for (ptrdiff_t block = 1; block < blockCount; ++block, blockStart += blockLength) {
+                        const ptrdiff_t restStart = blockStart - restLength;
+                        const int nextOrigin = compare(keys[block], *middleKey) ? 0 : 1;
+                        if (nextOrigin == restOrigin) {
+                            if (hasBuffer) {
+                                swap_n(elements + restStart - blockLength, elements + restStart, restLength);
+                            }
+                            restLength = blockLength;
+                        } else if (hasBuffer) {
+                            merge_blocks_with_buffer(elements + restStart, restLength, restOrigin, blockLength, blockLength, compare);
+                        } else {
+                            merge_blocks_without_buffer(elements + restStart, restLength, restOrigin, blockLength, compare);
+                        }
+                    }
+
+                    ptrdiff_t restStart = blockStart - restLength;
+                    if (tailLength > 0) {
+                        if (restOrigin != 0) {
+                            if (hasBuffer) {
+                                swap_n(elements + restStart - blockLength, elements + restStart, restLength);
+                            }
+                            restStart = blockStart;
+                            restLength = blockLength * tailBlockCount;
+                        } else {
+                            restLength += blockLength * tailBlockCount;
+                        }
+                        if (hasBuffer) {
+                            merge_left(elements + restStart, restLength, tailLength, -blockLength, compare);
+                        } else {
+                            merge_without_buffer(elements + restStart, restLength, tailLength, compare);
+                        }
+                    } else if (hasBuffer) {
+                        swap_n(elements + restStart, elements + (restStart - blockLength), restLength);
+                    }
+                }
+
+                /**
+                 * The first <code>bufferLength</code> elements before <code>elements</code> are the buffer,
+                 * which ends up at the front, followed by sorted runs of <code>2 * bufferLength</code> elements.
+                 * @brief Sorts runs of <code>2 * bufferLength</code> elements with the buffer.
+                 * @param elements The first element to be sorted.
+                 * @param length The number of elements to be sorted.
+                 * @param bufferLength The length of the buffer, a power of 2 not less than 2.
+                 * @param compare The comparator of elements.
+                 */
+                template<typename T, typename Compare>
+                void build_runs(T *elements, const ptrdiff_t length, const ptrdiff_t bufferLength, const Compare &compare) {
+                    // sort pairs, moving the buffer forward by 2
+                    for (ptrdiff_t i = 1; i < length; i += 2) {
+                        const ptrdiff_t inverted = compare(elements[i], elements[i - 1]) ? 1 : 0;
+                        utility::swap(elements[i - 3], elements[i - 1 + inverted]);
+                        utility::swap(elements[i - 2], elements[i - inverted]);
+                    }
+                    if (length % 2 != 0) {
+                        utility::swap(elements[length - 1], elements[length - 3]);
+                    }
+                    elements -= 2;
+
+                    ptrdiff_t width = 2;
+                    for (; width < bufferLength; width *= 2) {
+                        ptrdiff_t start = 0;
+                        for (; start <= length - 2 * width; start += 2 * width) {
+                            merge_left(elements + start, width, width, -width, compare);
+                        }
+                        const ptrdiff_t rest = length - start;
+                        if (rest > width) {
+                            merge_left(elements + start, width, rest - width, -width, compare);
+                        } else {
+                            rotate(elements + (start - width), width, rest);
+                        }
+                        elements -= width;
+                    }
+
+                    // move the buffer back to the front while making the last merge pass
+                    const ptrdiff_t rest = length % (2 * bufferLength);
+                    ptrdiff_t start = length - rest;
+                    if (rest <= bufferLength) {
+                        rotate(elements + start, rest, bufferLength);
+                    } else {
+                        merge_right(elements + start, bufferLength, rest - bufferLength, bufferLength, compare);
+                    }
+                    while (start > 0) {
+                        start -= 2 * bufferLength;
+                        merge_right(elements + start, bufferLength, bufferLength, bufferLength, compare);
+                    }
+                }
+
+                /**
+                 * Each pair of runs is cut into blocks, which are selection sorted by their first elements, with the keys breaking ties
+                 * in favor of the left run, and then merged block by block.
+                 * @brief Merges every adjacent pair of sorted runs of <code>runLength</code> elements.
+                 * @param keys The distinct keys, at least <code>2 * runLength / blockLength + 1</code> of them.
+                 * @param elements The first element of the runs, with the buffer of <code>blockLength</code> elements before it if <code>hasBuffer</code>.
+                 * @param length The number of elements in the runs.
+                 * @param runLength The length of the runs.
+                 * @param blockLength The length of the blocks, which divides <code>runLength</code>.
+                 * @param hasBuffer Whether the runs are merged through the buffer.
+                 * @param compare The comparator of elements.
+                 */
+                template<typename T, typename Compare>
+                void combine_runs(T *const keys, T *const elements, ptrdiff_t length, const ptrdiff_t runLength, const ptrdiff_t blockLength, const bool hasBuffer, const Compare &compare) {
+                    const ptrdiff_t pairCount = length / (2 * runLength);
+                    ptrdiff_t rest = length % (2 * runLength);
+                    if (rest <= runLength) { // the last run is already sorted and in place
+                        length -= rest;
+                        rest = 0;
+                    }
+
+                    for (ptrdiff_t pair = 0; pair <= pairCount; ++pair) {
+                        if (pair == pairCount && rest == 0) {
+                            break;
+                        }
+                        T *const runs = elements + pair * 2 * runLength;
+                        const ptrdiff_t blockCount = ((pair == pairCount) ? rest : 2 * runLength) / blockLength;
+                        insertion_sort(keys, 0, (size_t)(blockCount + ((pair == pairCount) ? 1 : 0)), compare);
+
+                        // selection sort the blocks, tracking where the key of the first right block goes
+                        ptrdiff_t middleKey = runLength / blockLength;
+                        for (ptrdiff_t i = 1; i < blockCount; ++i) {
+                            ptrdiff_t smallest = i - 1;
+                            for (ptrdiff_t j = i; j < blockCount; ++j) {
+                                const T &candidate = runs[j * blockLength];
+                                const T &current = runs[smallest * blockLength];
+                                if (compare(candidate, current) || (!compare(current, candidate) && compare(keys[j], keys[smallest]))) {
+                                    smallest = j;
+                                }
+                            }
+                            if (smallest != i - 1) {
+                                swap_n(runs + (i - 1) * blockLength, runs + smallest * blockLength, blockLength);
+                                utility::swap(keys[i - 1], keys[smallest]);
+                                if (middleKey == i - 1 || middleKey == smallest) {
+                                    middleKey ^= (i - 1) ^ smallest;
+                                }
+                            }
+                        }
+
+                        // the blocks of the left run going after the tail of the right run
+                        ptrdiff_t tailBlockCount = 0;
+                        const ptrdiff_t tailLength = (pair == pairCount) ? rest % blockLength : 0;
+                        if (tailLength != 0) {
+                            while (tailBlockCount < blockCount && compare(runs[blockCount * blockLength], runs[(blockCount - tailBlockCount - 1) * blockLength])) {
+                                ++tailBlockCount;
+                            }
+                        }
+                        merge_block_sequence(keys, keys + middleKey, runs, blockCount - tailBlockCount, blockLength, hasBuffer, tailBlockCount, tailLength, compare);
+                    }
+
+                    // move the buffer back before the runs
+                    if (hasBuffer) {
+                        while (--length >= 0) {
+                            utility::swap(elements[length], elements[length - blockLength]);
+                        }
+                    }
+                }
+
+                /**
+                 * It takes O(n log^2 n) time, for arrays with too few distinct elements to make a buffer.
+                 * @brief Sorts an array stably with rotation merges.
+                 */
+                template<typename T, typename Compare>
+                void lazy_stable_sort(T *const elements, const ptrdiff_t length, const Compare &compare) {
+                    for (ptrdiff_t i = 1; i < length; i += 2) {
+                        if (compare(elements[i], elements[i - 1])) {
+                            utility::swap(elements[i - 1], elements[i]);
+                        }
+                    }
+                    for (ptrdiff_t width = 2; width < length; width *= 2) {
+                        ptrdiff_t start = 0;
+                        for (; start <= length - 2 * width; start += 2 * width) {
+                            merge_without_buffer(elements + start, width, width, compare);
+                        }
+                        const ptrdiff_t rest = length - start;
+                        if (rest > width) {
+                            merge_without_buffer(elements + start, width, rest - width, compare);
+                        }
+                    }
+                }
+
+                /**
+                 * About <code>2 * sqrt(length)</code> distinct elements are collected at the front:
+                 * half of them are the keys tagging blocks, the other half is the buffer merges swap elements through.
+                 * With fewer distinct elements, the keys alone tag smaller blocks which are merged with rotations.
+                 * At the end, the keys and the buffer are sorted and merged back with rotations.
+                 * @brief Sorts an array stably in place with block merge sort.
+                 * @param elements The first element to be sorted.
+                 * @param length The number of elements to be sorted.
+                 * @param compare The comparator of elements.
+                 */
+                template<typename T, typename Compare>
+                void block_merge_sort(T *const elements, const ptrdiff_t length, const Compare &compare) {
+                    if (length < INSERTION_SORT_THRESHOLD) {
+                        insertion_sort(elements, 0, (size_t)length, compare);
+                        return;
+                    }
+
+                    ptrdiff_t blockLength = 1;
+                    while (blockLength * blockLength < length) {
+                        blockLength *= 2;
+                    }
+                    ptrdiff_t keyCount = (length - 1) / blockLength + 1;
+                    const ptrdiff_t foundCount = collect_keys(elements, length, keyCount + blockLength, compare);
+                    bool hasBuffer = true;
+                    if (foundCount < keyCount + blockLength) {
+                        if (foundCount < 4) {
+                            lazy_stable_sort(elements, length, compare);
+                            return;
+                        }
+                        keyCount = blockLength;
+                        while (keyCount > foundCount) {
+                            keyCount /= 2;
+                        }
+                        hasBuffer = false;
+                        blockLength = 0;
+                    }
+
+                    const ptrdiff_t start = blockLength + keyCount;
+                    ptrdiff_t runLength = hasBuffer ? blockLength : keyCount;
+                    build_runs(elements + start, length - start, runLength, compare);
+
+                    // runs of 2 * runLength elements are sorted
+                    while (length - start > (runLength *= 2)) {
+                        ptrdiff_t mergeBlockLength = blockLength;
+                        bool mergeHasBuffer = hasBuffer;
+                        if (!hasBuffer) {
+                            if (keyCount > 4 && keyCount / 8 * keyCount >= runLength) {
+                                // half of the keys are enough as a buffer for blocks this short
+                                mergeBlockLength = keyCount / 2;
+                                mergeHasBuffer = true;
+                            } else {
+                                ptrdiff_t blockCount = 1;
+                                unsigned long long scaled = (unsigned long long)runLength * (unsigned long long)foundCount / 2;
+                                while (blockCount < keyCount && scaled != 0) {
+                                    blockCount *= 2;
+                                    scaled /= 8;
+                                }
+                                mergeBlockLength = (2 * runLength) / blockCount;
+                            }
+                        }
+                        combine_runs(elements, elements + start, length - start, runLength, mergeBlockLength, mergeHasBuffer, compare);
+                    }
+
+                    insertion_sort(elements, 0, (size_t)start, compare);
+                    merge_without_buffer(elements, start, length - start, compare);
+                }
+            }
+            /**
+             * This block merge sort is stable and allocates no memory: it collects distinct elements of the array itself
+             * as a merge buffer and as keys tagging blocks, like GrailSort, and never recurses.
+             * It takes O(n log n) time, or O(n log^2 n) time when the array has fewer than 4 distinct elements.
+             * It is suited to devices with little RAM, where <code>merge_sort()</code> cannot allocate its buffer.
+             * @brief Sorts an array stably in place with block merge sort.
+             * @param T The type of elements to be sorted.
+             * @param elements The array of elements to be sorted.  This same array will be sorted after this function returns.
+             * @param start The index of the first element to be sorted.
+             * @param end The index of the first element not to be sorted after <code>start</code>.
+             * @param compare The comparator returning whether its first argument goes before its second.  It is <code>operator&lt;</code> by default.
+             */
+            template<typename T, typename Compare = utility::Less>
+            inline void block_merge_sort(T *const elements, const size_t start, const size_t end, Compare compare = Compare()) {
+                if (start + 1 >= end) {
+                    return;
+                }
+
+                _block_merge_sort::block_merge_sort(elements + start, (ptrdiff_t)(end - start), compare);
+            }
+        }
+    }
+}
+
+#endif // #ifndef YH_ALGO_SORT_BLOCK_MERGE_SORT_H
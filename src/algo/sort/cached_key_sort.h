@@ -0,0 +1,116 @@
+/**
+ * @file cached_key_sort.h The decorate-sort-undecorate implementation in C++.
+ * 
+ * @copyright Copyright (c) 2025 YH Choi. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef YH_ALGO_SORT_CACHED_KEY_SORT_H
+#define YH_ALGO_SORT_CACHED_KEY_SORT_H
+
+#ifdef ARDUINO
+#include <stddef.h>
+#else
+#include <cstddef>
+#endif
+
+#include "../../utility/functional.h"
+#include "../../utility/move.h"
+#include "../../utility/type_traits.h"
+#include "merge_sort.h"
+
+namespace yh {
+    namespace algo {
+        namespace sort {
+            namespace _cached_key_sort {
+                /**
+                 * @brief An element paired with its key, computed once.
+                 */
+                template<typename Key, typename T>
+                struct Decorated {
+                    Key key;
+                    T value;
+                };
+
+                /**
+                 * @brief Compares 2 decorated elements by their cached keys.
+                 */
+                template<typename Compare>
+                class DecoratedCompare {
+                    private:
+                        const Compare &compare;
+
+                    public:
+                        explicit DecoratedCompare(const Compare &compare) : compare(compare) {}
+
+                        template<typename Key, typename T>
+                        inline bool operator()(const Decorated<Key, T> &lhs, const Decorated<Key, T> &rhs) const {
+                            return compare(lhs.key, rhs.key);
+                        }
+                };
+            }
+            /**
+             * Every key is computed exactly once and stored next to its element, then the pairs are sorted with merge sort
+             * and the elements are moved back, so this suits keys which are expensive to compute, e.g. a hash or a parsed field.
+             * For cheap keys such as field accesses, sorting with <code>utility::by_key</code> avoids the extra memory.
+             * This sort is stable.
+             * @brief Sorts an array by keys computed once per element.
+             * @param T The type of elements to be sorted.
+             * @param elements The array of elements to be sorted.  This same array will be sorted after this function returns.
+             * @param start The index of the first element to be sorted.
+             * @param end The index of the first element not to be sorted after <code>start</code>.
+             * @param key The projection mapping an element to its key.  The key type must be default-constructible.
+             * @param compare The comparator of keys returning whether its first argument goes before its second.  It is <code>operator&lt;</code> by default.
+             */
+            template<typename T, typename KeyExtractor, typename Compare = utility::Less>
+            inline void cached_key_sort(T *const elements, const size_t start, const size_t end, KeyExtractor key, Compare compare = Compare()) {
+                if (start + 1 >= end) {
+                    return;
+                }
+
+                typedef typename utility::Decay<decltype(key(*elements))>::Type Key;
+                typedef _cached_key_sort::Decorated<Key, T> Element;
+
+                const size_t length = end - start;
+                Element *const decorated = new Element[length];
+                for (size_t i = 0; i < length; ++i) {
+                    decorated[i].key = key(elements[start + i]);
+                    decorated[i].value = utility::move(elements[start + i]);
+                }
+
+                merge_sort(decorated, 0, length, _cached_key_sort::DecoratedCompare<Compare>(compare));
+
+                for (size_t i = 0; i < length; ++i) {
+                    elements[start + i] = utility::move(decorated[i].value);
+                }
+                delete[] decorated;
+            }
+        }
+    }
+}
+
+#endif // #ifndef YH_ALGO_SORT_CACHED_KEY_SORT_H
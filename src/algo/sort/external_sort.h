@@ -0,0 +1,348 @@
+/**
+ * @file external_sort.h The external merge sort implementation in C++.
+ * 
+ * @copyright Copyright (c) 2025 YH Choi. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef YH_ALGO_SORT_EXTERNAL_SORT_H
+#define YH_ALGO_SORT_EXTERNAL_SORT_H
+
+#ifndef ARDUINO
+
+#include <cstddef>
+#include <cstdio>
+
+#include "../../utility/functional.h"
+#include "../merge/loser_tree.h"
+#include "pdq_sort.h"
+
+namespace yh {
+    namespace algo {
+        namespace sort {
+            namespace _external_sort {
+                /**
+                 * @brief The default number of bytes of records held in memory at once.
+                 */
+                static const size_t DEFAULT_MEMORY_BUDGET = 64U * 1024U * 1024U;
+
+                /**
+                 * @brief The default maximum number of runs merged at once.
+                 */
+                static const size_t DEFAULT_FAN_IN = 16U;
+
+                /**
+                 * @brief Reads the records of a file through a buffer.
+                 */
+                template<typename T>
+                class RunReader {
+                    private:
+                        FILE *file;
+                        T *buffer;
+                        size_t capacity;
+                        size_t count;
+                        size_t position;
+                        bool isFailed;
+
+                        void refill() {
+                            count = fread(buffer, sizeof(T), capacity, file);
+                            position = 0;
+                            if (count < capacity && ferror(file)) {
+                                isFailed = true;
+                            }
+                        }
+
+                    public:
+                        RunReader() : file(nullptr), buffer(nullptr), capacity(0), count(0), position(0), isFailed(false) {}
+
+                        /**
+                         * @brief Starts reading a file from its beginning.
+                         * @param file The file to be read.
+                         * @param buffer The buffer of at least <code>capacity</code> records.
+                         * @param capacity The number of records read at once.
+                         */
+                        void open(FILE *const file, T *const buffer, const size_t capacity) {
+                            this->file = file;
+                            this->buffer = buffer;
+                            this->capacity = capacity;
+                            this->isFailed = (fseek(file, 0, SEEK_SET) != 0);
+                            this->count = 0;
+                            this->position = 0;
+                            if (!isFailed) {
+                                refill();
+                            }
+                        }
+
+                        /**
+                         * @brief Gets the next record without consuming it.
+                         * @return The next record, or nullptr if there is no more record.
+                         */
+                        const T *peek() const {
+                            return (position < count) ? (buffer + position) : nullptr;
+                        }
+
+                        /**
+                         * @brief Consumes the next record.
+                         */
+                        void proceed() {
+                            if (++position == count && count == capacity) {
+                                refill();
+                            }
+                        }
+
+                        bool failed() const {
+                            return isFailed;
+                        }
+                };
+
+                /**
+                 * @brief Writes records to a file through a buffer.
+                 */
+                template<typename T>
+                class RunWriter {
+                    private:
+                        FILE *file;
+                        T *buffer;
+                        size_t capacity;
+                        size_t count;
+                        bool isFailed;
+
+                    public:
+                        RunWriter(FILE *const file, T *const buffer, const size_t capacity)
+                            : file(file), buffer(buffer), capacity(capacity), count(0), isFailed(false) {}
+
+                        void write(const T &record) {
+                            buffer[count] = record;
+                            if (++count == capacity) {
+                                flush();
+                            }
+                        }
+
+                        /**
+                         * @brief Writes all buffered records to the file.
+                         * @return Whether all records have been written so far.
+                         */
+                        bool flush() {
+                            if (count > 0 && fwrite(buffer, sizeof(T), count, file) != count) {
+                                isFailed = true;
+                            }
+                            count = 0;
+                            return !isFailed;
+                        }
+                };
+
+                /**
+                 * @brief Merges sorted runs into a file.
+                 * @param runs The files of sorted runs.
+                 * @param count The number of runs, at least 1.
+                 * @param output The file to be written.
+                 * @param memory The buffer of <code>recordCount</code> records shared by the readers and the writer.
+                 * @param recordCount The number of records in <code>memory</code>, at least <code>count + 1</code>.
+                 * @param compare The comparator of records.
+                 * @return Whether all runs have been read and merged successfully.
+                 */
+                template<typename T, typename Compare>
+                bool merge_runs(FILE *const *const runs, const size_t count, FILE *const output, T *const memory, const size_t recordCount, const Compare &compare) {
+                    const size_t bufferCapacity = recordCount / (count + 1);
+                    RunReader<T> *const readers = new RunReader<T>[count];
+                    for (size_t i = 0; i < count; ++i) {
+                        readers[i].open(runs[i], memory + i * bufferCapacity, bufferCapacity);
+                    }
+
+                    RunWriter<T> writer(output, memory + count * bufferCapacity, bufferCapacity);
+                    {
+                        merge::LoserTree<RunReader<T>, Compare> tree(readers, count, compare);
+                        for (const T *record = tree.top(); record != nullptr; record = tree.top()) {
+                            writer.write(*record);
+                            tree.pop();
+                        }
+                    }
+                    bool isSucceeded = writer.flush();
+                    for (size_t i = 0; i < count; ++i) {
+                        isSucceeded = isSucceeded && !readers[i].failed();
+                    }
+                    delete[] readers;
+                    return isSucceeded;
+                }
+
+                /**
+                 * @brief Closes files and clears their pointers.
+                 */
+                inline void close_files(FILE **const files, const size_t count) {
+                    for (size_t i = 0; i < count; ++i) {
+                        if (files[i] != nullptr) {
+                            fclose(files[i]);
+                            files[i] = nullptr;
+                        }
+                    }
+                }
+
+                /**
+                 * Runs are merged <code>fanIn</code> at a time into new temporary files until at most <code>fanIn</code> are left,
+                 * which are then merged into <code>output</code>.
+                 * @brief Merges sorted runs into a file, in as many passes as needed.
+                 * @param runs The files of sorted runs, which are all closed after this function returns.
+                 * @param count The number of runs, at least 1.
+                 * @param compare The comparator of records.
+                 * @return Whether the runs have been merged successfully.
+                 */
+                template<typename T, typename Compare>
+                bool merge_all(FILE **const runs, size_t count, FILE *const output, T *const memory, const size_t recordCount, const size_t fanIn, const Compare &compare) {
+                    bool isSucceeded = true;
+                    while (isSucceeded && count > fanIn) {
+                        size_t merged = 0;
+                        for (size_t first = 0; first < count; first += fanIn) {
+                            const size_t groupCount = (count - first < fanIn) ? (count - first) : fanIn;
+                            FILE *const file = tmpfile();
+                            if (file == nullptr || !merge_runs(runs + first, groupCount, file, memory, recordCount, compare)) {
+                                if (file != nullptr) {
+                                    fclose(file);
+                                }
+                                isSucceeded = false;
+                                break;
+                            }
+                            close_files(runs + first, groupCount);
+                            runs[merged++] = file;
+                        }
+                        if (!isSucceeded) {
+                            close_files(runs, count);
+                            return false;
+                        }
+                        count = merged;
+                    }
+
+                    isSucceeded = merge_runs(runs, count, output, memory, recordCount, compare);
+                    close_files(runs, count);
+                    return isSucceeded;
+                }
+            }
+            /**
+             * The input file is read in chunks fitting <code>memoryBudget</code>, each sorted in memory with pdq_sort
+             * and spilled to a temporary file as a sorted run.  The runs are then merged by a loser tree,
+             * at most <code>fanIn</code> at a time, through large sequential buffers carved from the same budget.
+             * If the whole input fits in one chunk, it is sorted in memory and written directly.
+             * Records are copied as raw bytes, so <code>T</code> must be trivially copyable.
+             * This sort is not stable.
+             * @brief Sorts a file of fixed-size records which may be larger than memory.
+             * @param T The type of records to be sorted.
+             * @param inputPath The path of the file to be sorted, whose size must be a multiple of <code>sizeof(T)</code>.
+             * @param outputPath The path of the file to write the sorted records to, which is overwritten.  It must not be <code>inputPath</code>.
+             * @param memoryBudget The number of bytes of records held in memory at once.
+             * @param fanIn The maximum number of runs merged at once, at least 2.
+             * @param compare The comparator returning whether its first argument goes before its second.  It is <code>operator&lt;</code> by default.
+             * @return Whether the file has been sorted successfully.
+             */
+            template<typename T, typename Compare = utility::Less>
+            bool external_sort(const char *const inputPath, const char *const outputPath,
+                const size_t memoryBudget = _external_sort::DEFAULT_MEMORY_BUDGET, const size_t fanIn = _external_sort::DEFAULT_FAN_IN,
+                Compare compare = Compare()) {
+                if (inputPath == nullptr || outputPath == nullptr || fanIn < 2) {
+                    return false;
+                }
+
+                // the merge needs a record of buffer for every run merged and for the output
+                size_t recordCount = memoryBudget / sizeof(T);
+                if (recordCount < fanIn + 1) {
+                    recordCount = fanIn + 1;
+                }
+
+                FILE *const input = fopen(inputPath, "rb");
+                if (input == nullptr) {
+                    return false;
+                }
+                FILE *const output = fopen(outputPath, "wb");
+                if (output == nullptr) {
+                    fclose(input);
+                    return false;
+                }
+
+                T *const memory = new T[recordCount];
+                size_t runCapacity = 16;
+                size_t runCount = 0;
+                FILE **runs = new FILE *[runCapacity];
+                bool isSucceeded = true;
+                bool isSortedInMemory = false;
+
+                // sort every chunk and spill it as a run
+                while (isSucceeded) {
+                    const size_t count = fread(memory, sizeof(T), recordCount, input);
+                    if (count < recordCount && (ferror(input) || ftell(input) % (long)sizeof(T) != 0)) {
+                        isSucceeded = false; // a read error or a partial record
+                        break;
+                    }
+                    if (count == 0) {
+                        break;
+                    }
+                    pdq_sort(memory, 0, count, compare);
+
+                    if (runCount == 0 && count < recordCount) { // the whole input fits in memory
+                        isSucceeded = (fwrite(memory, sizeof(T), count, output) == count);
+                        isSortedInMemory = true;
+                        break;
+                    }
+
+                    FILE *const run = tmpfile();
+                    if (run == nullptr || fwrite(memory, sizeof(T), count, run) != count) {
+                        if (run != nullptr) {
+                            fclose(run);
+                        }
+                        isSucceeded = false;
+                        break;
+                    }
+                    if (runCount == runCapacity) {
+                        FILE **const newRuns = new FILE *[runCapacity * 2];
+                        for (size_t i = 0; i < runCount; ++i) {
+                            newRuns[i] = runs[i];
+                        }
+                        delete[] runs;
+                        runs = newRuns;
+                        runCapacity *= 2;
+                    }
+                    runs[runCount++] = run;
+                }
+                fclose(input);
+
+                if (isSucceeded && !isSortedInMemory && runCount > 0) {
+                    isSucceeded = _external_sort::merge_all(runs, runCount, output, memory, recordCount, fanIn, compare);
+                } else {
+                    _external_sort::close_files(runs, runCount);
+                }
+
+                delete[] runs;
+                delete[] memory;
+                if (fclose(output) != 0) {
+                    isSucceeded = false;
+                }
+                return isSucceeded;
+            }
+        }
+    }
+}
+
+#endif // #ifndef ARDUINO
+
+#endif // #ifndef YH_ALGO_SORT_EXTERNAL_SORT_H
\ No newline at end of file
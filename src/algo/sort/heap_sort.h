@@ -38,44 +38,102 @@
 #include <cstddef>
 #endif
 
-#include "../../structures/heaps/MinArrayHeap.h"
+#include "../../utility/functional.h"
+#include "../../utility/move.h"
 
 namespace yh {
     namespace algo {
         namespace sort {
+            namespace _heap_sort {
+                /**
+                 * The element is first bounced down to a leaf along the greater children,
+                 * costing 1 comparison per level, and then sifted up to where it belongs.
+                 * As the element usually belongs near the leaves, this takes about half
+                 * the comparisons of the classic sift-down.
+                 * @brief Moves an element down a max heap until the heap property is restored.
+                 * @param heap The max heap, whose children of <code>heap[i]</code> are <code>heap[2 * i + 1]</code> and <code>heap[2 * i + 2]</code>.
+                 * @param top The index of the element to be moved down.  Both subtrees under it must be max heaps.
+                 * @param length The number of elements in the heap.
+                 * @param compare The comparator of elements.
+                 */
+                template<typename T, typename Compare>
+                inline void sift_down(T *const heap, const size_t top, const size_t length, const Compare &compare) {
+                    T element = utility::move(heap[top]);
+
+                    // bounce the hole down to a leaf
+                    size_t hole = top;
+                    size_t child = hole * 2 + 2;
+                    while (child < length) {
+                        if (compare(heap[child], heap[child - 1])) {
+                            --child;
+                        }
+                        heap[hole] = utility::move(heap[child]);
+                        hole = child;
+                        child = hole * 2 + 2;
+                    }
+                    if (child == length) { // only a left child
+                        heap[hole] = utility::move(heap[child - 1]);
+                        hole = child - 1;
+                    }
+
+                    // sift the element up from the leaf
+                    while (hole > top) {
+                        const size_t parent = (hole - 1) / 2;
+                        if (!compare(heap[parent], element)) {
+                            break;
+                        }
+                        heap[hole] = utility::move(heap[parent]);
+                        hole = parent;
+                    }
+                    heap[hole] = utility::move(element);
+                }
+
+                /**
+                 * @brief Arranges an array into a max heap with Floyd's bottom-up construction in O(n).
+                 * @param heap The elements to be arranged.
+                 * @param length The number of elements.
+                 * @param compare The comparator of elements.
+                 */
+                template<typename T, typename Compare>
+                inline void make_heap(T *const heap, const size_t length, const Compare &compare) {
+                    for (size_t i = length / 2; i > 0; --i) {
+                        sift_down(heap, i - 1, length, compare);
+                    }
+                }
+
+                /**
+                 * @brief Sorts a max heap into ascending order by repeatedly moving the maximum behind the shrinking heap.
+                 * @param heap The max heap to be sorted.
+                 * @param length The number of elements in the heap.
+                 * @param compare The comparator of elements.
+                 */
+                template<typename T, typename Compare>
+                inline void sort_heap(T *const heap, const size_t length, const Compare &compare) {
+                    for (size_t i = length - 1; i > 0; --i) {
+                        utility::swap(heap[0], heap[i]);
+                        sift_down(heap, 0, i, compare);
+                    }
+                }
+            }
             /**
+             * The array is sorted in place with O(1) extra memory and no heap allocations.
              * @brief Sorts an array with heap sort.
              * @param T The type of elements to be sorted.
              * @param elements The array of elements to be sorted.  This same array will be sorted after this function returns.
              * @param start The index of the first element to be sorted.
              * @param end The index of the first element not to be sorted after <code>start</code>.
+             * @param compare The comparator returning whether its first argument goes before its second.  It is <code>operator&lt;</code> by default.
              */
-            template<typename T>
-            inline void heap_sort(T *const elements, const size_t start, const size_t end) {
+            template<typename T, typename Compare = utility::Less>
+            inline void heap_sort(T *const elements, const size_t start, const size_t end, Compare compare = Compare()) {
                 if (start + 1 >= end) {
                     return;
                 }
 
+                T *const heap = elements + start;
                 const size_t toSortLength = end - start;
-
-                // create a buffer to hold the elements temporarily
-                T *elementsBuffer = new T[toSortLength];
-                for (size_t i = 0; i < toSortLength; ++i) {
-                    elementsBuffer[i] = elements[start + i];
-                }
-
-                // create a min heap and insert elements from the buffer to the heap
-                yh::structures::heaps::MinArrayHeap<T> heap(toSortLength);
-                for (size_t i = 0; i < toSortLength; ++i) {
-                    heap.insert(elementsBuffer + i);
-                }
-
-                // copy the minimum elements from the heap back to the original array
-                for (size_t i = start; i < end; ++i) {
-                    elements[i] = (*heap.removeMin());
-                }
-
-                delete[] elementsBuffer;
+                _heap_sort::make_heap(heap, toSortLength, compare);
+                _heap_sort::sort_heap(heap, toSortLength, compare);
             }
         }
     }
@@ -38,34 +38,38 @@
 #include <cstddef>
 #endif
 
+#include "../../utility/functional.h"
+#include "../../utility/move.h"
+
 namespace yh {
     namespace algo {
         namespace sort {
-            namespace _insertion_sort {
-                template<typename T>
-                inline void swap(T &lhs, T &rhs) {
-                    T temp = lhs; // copy lhs to temp
-                    lhs = rhs; // move rhs to lhs
-                    rhs = temp; // move temp to rhs
-                }
-            }
             /**
              * @brief Sorts an array with insertion sort.
              * @param T The type of elements to be sorted.
              * @param elements The array of elements to be sorted.  This same array will be sorted after this function returns.
              * @param start The index of the first element to be sorted.
              * @param end The index of the first element not to be sorted after <code>start</code>.
+             * @param compare The comparator returning whether its first argument goes before its second.  It is <code>operator&lt;</code> by default.
              */
-            template<typename T>
-            inline void insertion_sort(T *const elements, const size_t start, const size_t end) {
+            template<typename T, typename Compare = utility::Less>
+            inline void insertion_sort(T *const elements, const size_t start, const size_t end, Compare compare = Compare()) {
                 if (start + 1 >= end) {
                     return;
                 }
 
                 for (size_t i = start + 1; i < end; ++i) {
-                    for (size_t j = i; (j > start) && (elements[j] < elements[j - 1]); --j) {
-                        _insertion_sort::swap(elements[j], elements[j - 1]);
+                    if (!compare(elements[i], elements[i - 1])) {
+                        continue;
                     }
+                    // move the element out and shift the greater elements right into its hole
+                    T element = utility::move(elements[i]);
+                    size_t hole = i;
+                    do {
+                        elements[hole] = utility::move(elements[hole - 1]);
+                        --hole;
+                    } while (hole > start && compare(element, elements[hole - 1]));
+                    elements[hole] = utility::move(element);
                 }
             }
         }
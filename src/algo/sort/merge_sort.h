@@ -38,70 +38,374 @@
 #include <cstddef>
 #endif
 
+#include "../../utility/functional.h"
+#include "../../utility/move.h"
+#include "../../utility/type_traits.h"
+#include "insertion_sort.h"
+#include "sorting_network.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE4_1__)
+#include <smmintrin.h>
+#endif
+
 namespace yh {
     namespace algo {
         namespace sort {
+            namespace _merge_sort {
+                /**
+                 * Sorting networks are not stable, so they sort these runs only for integer types, whose equal elements are indistinguishable.
+                 * @brief The length of the runs sorted by a sorting network or insertion sort before the first merge pass.
+                 */
+                static const size_t INSERTION_SORT_RUN = 16U;
+
+                /**
+                 * @brief Whether the runs of <code>T</code> ordered by <code>Compare</code> may be sorted by a sorting network without breaking stability.
+                 */
+                template<typename T, typename Compare>
+                struct IsNetworkStable {
+                    static const bool VALUE = utility::IsIntegral<T>::VALUE && utility::IsSame<Compare, utility::Less>::VALUE;
+                };
+
+                /**
+                 * Equal elements are taken from the left run first, so the merge is stable.
+                 * The elements are moved, so both runs are left unspecified.
+                 * @brief Merges 2 sorted runs into another array one element at a time.
+                 * @param lhs_ptr The first element of the left run.
+                 * @param lhs_end The element after the last element of the left run.
+                 * @param rhs_ptr The first element of the right run.
+                 * @param rhs_end The element after the last element of the right run.
+                 * @param sorted_ptr The destination which does not overlap with both runs.
+                 * @param compare The comparator of elements.
+                 */
+                template<typename T, typename Compare>
+                inline void scalar_merge(T *lhs_ptr, T *const lhs_end, T *rhs_ptr, T *const rhs_end, T *sorted_ptr, const Compare &compare) {
+                    // merge the 2 sorted arrays
+                    if (lhs_ptr < lhs_end && rhs_ptr < rhs_end && compare(*rhs_ptr, *(lhs_end - 1))) {
+                        while (lhs_ptr < lhs_end && rhs_ptr < rhs_end) {
+                            if (!compare(*rhs_ptr, *lhs_ptr)) { // lhs <= rhs
+                                (*sorted_ptr) = utility::move(*lhs_ptr);
+                                ++lhs_ptr;
+                            } else {
+                                (*sorted_ptr) = utility::move(*rhs_ptr);
+                                ++rhs_ptr;
+                            }
+                            ++sorted_ptr;
+                        }
+                    }
+
+                    // move the remaining elements from lhs and then rhs
+                    utility::move_forward(lhs_ptr, sorted_ptr, (size_t)(lhs_end - lhs_ptr));
+                    sorted_ptr += lhs_end - lhs_ptr;
+                    utility::move_forward(rhs_ptr, sorted_ptr, (size_t)(rhs_end - rhs_ptr));
+                }
+
+                /**
+                 * @brief Whether the runs of <code>T</code> ordered by <code>Compare</code> may be merged by the vector kernel.
+                 */
+                template<typename T, typename Compare>
+                struct IsVectorMergeable {
+                    static const bool VALUE = false;
+                };
+
+#if defined(__AVX2__) || defined(__SSE4_1__)
+#if defined(__AVX2__)
+                typedef __m256i Vector;
+#else
+                typedef __m128i Vector;
+#endif
+
+                /**
+                 * @brief The number of 32-bit lanes in a vector.
+                 */
+                static const size_t VECTOR_LENGTH = sizeof(Vector) / 4U;
+
+                /**
+                 * Only 32-bit integers are merged by the kernel: their equal elements are indistinguishable, so the unstable network keeps the merge stable,
+                 * whereas the minimum and maximum of floats would duplicate NaNs and reorder <code>-0.0</code> and <code>+0.0</code>.
+                 * @brief The lane-wise minimum and maximum of vectors of <code>T</code>.
+                 */
+                template<typename T>
+                struct Lanes;
+
+                template<>
+                struct Lanes<int> {
+#if defined(__AVX2__)
+                    static inline Vector min(const Vector lhs, const Vector rhs) { return _mm256_min_epi32(lhs, rhs); }
+                    static inline Vector max(const Vector lhs, const Vector rhs) { return _mm256_max_epi32(lhs, rhs); }
+#else
+                    static inline Vector min(const Vector lhs, const Vector rhs) { return _mm_min_epi32(lhs, rhs); }
+                    static inline Vector max(const Vector lhs, const Vector rhs) { return _mm_max_epi32(lhs, rhs); }
+#endif
+                };
+
+                template<>
+                struct Lanes<unsigned int> {
+#if defined(__AVX2__)
+                    static inline Vector min(const Vector lhs, const Vector rhs) { return _mm256_min_epu32(lhs, rhs); }
+                    static inline Vector max(const Vector lhs, const Vector rhs) { return _mm256_max_epu32(lhs, rhs); }
+#else
+                    static inline Vector min(const Vector lhs, const Vector rhs) { return _mm_min_epu32(lhs, rhs); }
+                    static inline Vector max(const Vector lhs, const Vector rhs) { return _mm_max_epu32(lhs, rhs); }
+#endif
+                };
+
+                template<>
+                struct IsVectorMergeable<int, utility::Less> {
+                    static const bool VALUE = true;
+                };
+
+                template<>
+                struct IsVectorMergeable<unsigned int, utility::Less> {
+                    static const bool VALUE = true;
+                };
+
+                template<typename T>
+                inline Vector load_lanes(const T *const elements) {
+#if defined(__AVX2__)
+                    return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(elements));
+#else
+                    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(elements));
+#endif
+                }
+
+                template<typename T>
+                inline void store_lanes(T *const elements, const Vector v) {
+#if defined(__AVX2__)
+                    _mm256_storeu_si256(reinterpret_cast<__m256i *>(elements), v);
+#else
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(elements), v);
+#endif
+                }
+
+                /**
+                 * @brief Sorts the lanes of a bitonic vector with comparators at distances 4, 2 and 1.
+                 */
+                template<typename T>
+                inline Vector sort_bitonic_lanes(Vector v) {
+#if defined(__AVX2__)
+                    Vector s = _mm256_permute2x128_si256(v, v, 1);
+                    v = _mm256_blend_epi32(Lanes<T>::min(v, s), Lanes<T>::max(v, s), 0xF0);
+                    s = _mm256_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2));
+                    v = _mm256_blend_epi32(Lanes<T>::min(v, s), Lanes<T>::max(v, s), 0xCC);
+                    s = _mm256_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1));
+                    v = _mm256_blend_epi32(Lanes<T>::min(v, s), Lanes<T>::max(v, s), 0xAA);
+#else
+                    Vector s = _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2));
+                    v = _mm_blend_epi16(Lanes<T>::min(v, s), Lanes<T>::max(v, s), 0xF0);
+                    s = _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1));
+                    v = _mm_blend_epi16(Lanes<T>::min(v, s), Lanes<T>::max(v, s), 0xCC);
+#endif
+                    return v;
+                }
+
+                /**
+                 * The second vector is reversed so that both form a bitonic sequence, which the network sorts without a branch.
+                 * @brief Merges 2 sorted vectors into the lower and the upper halves of their elements.
+                 * @param lo A sorted vector, set to the smaller half sorted.
+                 * @param hi A sorted vector, set to the larger half sorted.
+                 */
+                template<typename T>
+                inline void merge_lanes(Vector &lo, Vector &hi) {
+#if defined(__AVX2__)
+                    const Vector reversed = _mm256_permutevar8x32_epi32(hi, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+#else
+                    const Vector reversed = _mm_shuffle_epi32(hi, _MM_SHUFFLE(0, 1, 2, 3));
+#endif
+                    const Vector low = Lanes<T>::min(lo, reversed);
+                    hi = sort_bitonic_lanes<T>(Lanes<T>::max(lo, reversed));
+                    lo = sort_bitonic_lanes<T>(low);
+                }
+
+                /**
+                 * The runs are merged a vector at a time: the upper half of every merge is merged again with the next vector
+                 * of the run whose next element is smaller, so only 1 branch is taken per vector instead of per element.
+                 * The elements left at the ends of the runs are merged by <code>scalar_merge()</code>.
+                 * @brief Merges 2 sorted runs of 32-bit integers into another array with a bitonic merge network.
+                 * @param lhs_ptr The first element of the left run.
+                 * @param lhs_end The element after the last element of the left run.
+                 * @param rhs_ptr The first element of the right run.
+                 * @param rhs_end The element after the last element of the right run.
+                 * @param sorted_ptr The destination which does not overlap with both runs.
+                 * @param compare The comparator of elements.
+                 */
+                template<typename T, typename Compare>
+                inline void vector_merge(T *lhs_ptr, T *const lhs_end, T *rhs_ptr, T *const rhs_end, T *sorted_ptr, const Compare &compare) {
+                    if ((size_t)(lhs_end - lhs_ptr) < VECTOR_LENGTH || (size_t)(rhs_end - rhs_ptr) < VECTOR_LENGTH || !compare(*rhs_ptr, *(lhs_end - 1))) {
+                        scalar_merge(lhs_ptr, lhs_end, rhs_ptr, rhs_end, sorted_ptr, compare);
+                        return;
+                    }
+
+                    Vector lo = load_lanes(lhs_ptr);
+                    Vector hi = load_lanes(rhs_ptr);
+                    lhs_ptr += VECTOR_LENGTH;
+                    rhs_ptr += VECTOR_LENGTH;
+                    while (true) {
+                        merge_lanes<T>(lo, hi);
+                        store_lanes(sorted_ptr, lo);
+                        sorted_ptr += VECTOR_LENGTH;
+
+                        const bool fromLhs = (rhs_ptr == rhs_end) || (lhs_ptr < lhs_end && !compare(*rhs_ptr, *lhs_ptr));
+                        T *&next = fromLhs ? lhs_ptr : rhs_ptr;
+                        if ((size_t)((fromLhs ? lhs_end : rhs_end) - next) < VECTOR_LENGTH) {
+                            break;
+                        }
+                        lo = load_lanes(next);
+                        next += VECTOR_LENGTH;
+                    }
+
+                    // merge the upper half with the rest of both runs
+                    T upper [VECTOR_LENGTH];
+                    store_lanes(upper, hi);
+                    T *upper_ptr = upper;
+                    T *const upper_end = upper + VECTOR_LENGTH;
+                    while (upper_ptr < upper_end && lhs_ptr < lhs_end && rhs_ptr < rhs_end) {
+                        T *&smallest = compare(*rhs_ptr, *lhs_ptr) ? (compare(*upper_ptr, *rhs_ptr) ? upper_ptr : rhs_ptr) : (compare(*upper_ptr, *lhs_ptr) ? upper_ptr : lhs_ptr);
+                        *sorted_ptr = *smallest;
+                        ++smallest;
+                        ++sorted_ptr;
+                    }
+                    if (upper_ptr == upper_end) {
+                        scalar_merge(lhs_ptr, lhs_end, rhs_ptr, rhs_end, sorted_ptr, compare);
+                    } else if (lhs_ptr == lhs_end) {
+                        scalar_merge(upper_ptr, upper_end, rhs_ptr, rhs_end, sorted_ptr, compare);
+                    } else {
+                        scalar_merge(upper_ptr, upper_end, lhs_ptr, lhs_end, sorted_ptr, compare);
+                    }
+                }
+#endif // #if defined(__AVX2__) || defined(__SSE4_1__)
+
+                /**
+                 * @brief Merges 2 sorted runs with <code>scalar_merge()</code>, or with <code>vector_merge()</code> if <code>USE_VECTOR</code>.
+                 */
+                template<bool USE_VECTOR>
+                struct Merge {
+                    template<typename T, typename Compare>
+                    static inline void merge(T *const lhs_ptr, T *const lhs_end, T *const rhs_ptr, T *const rhs_end, T *const sorted_ptr, const Compare &compare) {
+                        scalar_merge(lhs_ptr, lhs_end, rhs_ptr, rhs_end, sorted_ptr, compare);
+                    }
+                };
+
+#if defined(__AVX2__) || defined(__SSE4_1__)
+                template<>
+                struct Merge<true> {
+                    template<typename T, typename Compare>
+                    static inline void merge(T *const lhs_ptr, T *const lhs_end, T *const rhs_ptr, T *const rhs_end, T *const sorted_ptr, const Compare &compare) {
+                        vector_merge(lhs_ptr, lhs_end, rhs_ptr, rhs_end, sorted_ptr, compare);
+                    }
+                };
+#endif
+
+                /**
+                 * Equal elements are taken from the left run first, so the merge is stable.
+                 * The elements are moved, so both runs are left unspecified.
+                 * 32-bit integers ordered by <code>utility::Less</code> are merged by <code>vector_merge()</code> when AVX2 or SSE4.1 is enabled.
+                 * @brief Merges 2 sorted runs into another array.
+                 * @param lhs_ptr The first element of the left run.
+                 * @param lhs_end The element after the last element of the left run.
+                 * @param rhs_ptr The first element of the right run.
+                 * @param rhs_end The element after the last element of the right run.
+                 * @param sorted_ptr The destination which does not overlap with both runs.
+                 * @param compare The comparator of elements.
+                 */
+                template<typename T, typename Compare>
+                inline void merge(T *const lhs_ptr, T *const lhs_end, T *const rhs_ptr, T *const rhs_end, T *const sorted_ptr, const Compare &compare) {
+                    Merge<IsVectorMergeable<T, Compare>::VALUE>::merge(lhs_ptr, lhs_end, rhs_ptr, rhs_end, sorted_ptr, compare);
+                }
+
+                /**
+                 * @brief Merges every adjacent pair of sorted runs from one array into another array.
+                 * @param source The array holding sorted runs of <code>width</code> elements (the last run may be shorter).
+                 * @param destination The array to hold sorted runs of <code>2 * width</code> elements.
+                 * @param length The number of elements in both arrays.
+                 * @param width The length of the runs in <code>source</code>.
+                 * @param compare The comparator of elements.
+                 */
+                template<typename T, typename Compare>
+                inline void merge_pass(T *const source, T *const destination, const size_t length, const size_t width, const Compare &compare) {
+                    for (size_t lhs = 0; lhs < length; lhs += width * 2) {
+                        const size_t rhs = (length - lhs > width) ? lhs + width : length;
+                        const size_t rhs_end = (length - rhs > width) ? rhs + width : length;
+                        merge(source + lhs, source + rhs, source + rhs, source + rhs_end, destination + lhs, compare);
+                    }
+                }
+
+                /**
+                 * The runs bounce between <code>elements</code> and <code>buffer</code> on every pass,
+                 * and are copied back to <code>elements</code> at most once at the end.
+                 * @brief Sorts an array with bottom-up merge sort.
+                 * @param elements The first element to be sorted.
+                 * @param buffer The scratch space of at least <code>length</code> elements.
+                 * @param length The number of elements to be sorted.
+                 * @param compare The comparator of elements.
+                 */
+                template<typename T, typename Compare>
+                void bottom_up_merge_sort(T *const elements, T *const buffer, const size_t length, const Compare &compare) {
+                    for (size_t run = 0; run < length; run += INSERTION_SORT_RUN) {
+                        const size_t runEnd = (length - run > INSERTION_SORT_RUN) ? run + INSERTION_SORT_RUN : length;
+                        _sorting_network::SmallSort<IsNetworkStable<T, Compare>::VALUE>::sort(elements, run, runEnd, compare);
+                    }
+
+                    T *source = elements;
+                    T *destination = buffer;
+                    for (size_t width = INSERTION_SORT_RUN; width < length; width *= 2) {
+                        merge_pass(source, destination, length, width, compare);
+                        T *const temp = source;
+                        source = destination;
+                        destination = temp;
+                    }
+
+                    // move the sorted elements from buffer[] back to elements[]
+                    if (source != elements) {
+                        utility::move_forward(source, elements, length);
+                    }
+                }
+            }
             /**
-             * @brief Sorts an array with merge sort.
+             * This merge sort is stable and bottom-up, so it never recurses.
+             * @brief Sorts an array with merge sort using a scratch buffer provided by the caller.
              * @param T The type of elements to be sorted.
              * @param elements The array of elements to be sorted.  This same array will be sorted after this function returns.
              * @param start The index of the first element to be sorted.
              * @param end The index of the first element not to be sorted after <code>start</code>.
+             * @param buffer The scratch space of at least <code>end - start</code> elements.  Its contents are unspecified after this function returns.
+             * @param compare The comparator returning whether its first argument goes before its second.  It is <code>operator&lt;</code> by default.
              */
-            template<typename T>
-            inline void merge_sort(T *const elements, const size_t start, const size_t end) {
+            template<typename T, typename Compare = utility::Less>
+            inline void merge_sort(T *const elements, const size_t start, const size_t end, T *const buffer, Compare compare = Compare()) {
                 if (start + 1 >= end) {
                     return;
                 }
 
-                // sort the 2 halves separately
-                const size_t mid = (start + end) / 2;
-                merge_sort(elements, start, mid);
-                merge_sort(elements, mid, end);
-
-                T sorted[end - start];
-                T *sorted_ptr = sorted;
-                const T *lhs_ptr = elements + start;
-                const T *rhs_ptr = elements + mid;
-                const T *const lhs_end = rhs_ptr; // elements + mid
-                const T *const rhs_end = elements + end;
-
-                // merge the 2 sorted arrays
-                while (lhs_ptr < lhs_end && rhs_ptr < rhs_end) {
-                    const T lhs = *lhs_ptr;
-                    const T rhs = *rhs_ptr;
-                    if (!(rhs < lhs)) { // lhs <= rhs
-                        (*sorted_ptr) = lhs;
-                        ++lhs_ptr;
-                    } else {
-                        (*sorted_ptr) = rhs;
-                        ++rhs_ptr;
-                    }
-                    ++sorted_ptr;
-                }
+                _merge_sort::bottom_up_merge_sort(elements + start, buffer, end - start, compare);
+            }
 
-                // copy the remaining elements from lhs
-                while (lhs_ptr < lhs_end) {
-                    (*sorted_ptr) = (*lhs_ptr);
-                    ++lhs_ptr;
-                    ++sorted_ptr;
+            /**
+             * This merge sort is stable and bottom-up, so it never recurses.
+             * A scratch buffer of <code>end - start</code> elements is allocated once.
+             * @brief Sorts an array with merge sort.
+             * @param T The type of elements to be sorted.
+             * @param elements The array of elements to be sorted.  This same array will be sorted after this function returns.
+             * @param start The index of the first element to be sorted.
+             * @param end The index of the first element not to be sorted after <code>start</code>.
+             * @param compare The comparator returning whether its first argument goes before its second.  It is <code>operator&lt;</code> by default.
+             */
+            template<typename T, typename Compare = utility::Less>
+            inline void merge_sort(T *const elements, const size_t start, const size_t end, Compare compare = Compare()) {
+                if (start + 1 >= end) {
+                    return;
                 }
 
-                // copy the remaining elements from rhs
-                while (rhs_ptr < rhs_end) {
-                    (*sorted_ptr) = (*rhs_ptr);
-                    ++rhs_ptr;
-                    ++sorted_ptr;
+                const size_t toSortLength = end - start;
+                if (toSortLength <= _merge_sort::INSERTION_SORT_RUN) {
+                    _sorting_network::SmallSort<_merge_sort::IsNetworkStable<T, Compare>::VALUE>::sort(elements, start, end, compare);
+                    return;
                 }
 
-                // copy the sorted part from sorted[] back to elements[]
-                sorted_ptr = sorted;
-                T *elements_ptr = elements + start;
-                while (elements_ptr < rhs_end) {
-                    (*elements_ptr) = (*sorted_ptr);
-                    ++elements_ptr;
-                    ++sorted_ptr;
-                }
+                T *const buffer = new T[toSortLength];
+                _merge_sort::bottom_up_merge_sort(elements + start, buffer, toSortLength, compare);
+                delete[] buffer;
             }
         }
     }
@@ -0,0 +1,155 @@
+/**
+ * @file nth_element.h The selection (introselect) implementation in C++.
+ * 
+ * @copyright Copyright (c) 2025 YH Choi. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef YH_ALGO_SORT_NTH_ELEMENT_H
+#define YH_ALGO_SORT_NTH_ELEMENT_H
+
+#ifdef ARDUINO
+#include <stddef.h>
+#else
+#include <cstddef>
+#endif
+
+#include "../../utility/functional.h"
+#include "../../utility/move.h"
+#include "insertion_sort.h"
+#include "quick_sort.h"
+
+namespace yh {
+    namespace algo {
+        namespace sort {
+            namespace _nth_element {
+                /**
+                 * @brief Ranges not longer than this are finished with insertion sort.
+                 */
+                static const size_t INSERTION_SORT_THRESHOLD = 16U;
+
+                /**
+                 * Quickselect partitions about 3n elements on average, so this is only exceeded by bad pivot sequences.
+                 * @brief The number of elements, as a multiple of the length, quickselect may partition before switching to median-of-medians.
+                 */
+                static const size_t WORK_LIMIT_FACTOR = 6U;
+
+                /**
+                 * @brief The number of elements in each group of the median-of-medians.
+                 */
+                static const size_t GROUP_LENGTH = 5U;
+
+                template<typename T, typename Compare>
+                void select(T *const elements, size_t start, const size_t nth, size_t end, size_t work, const Compare &compare);
+
+                /**
+                 * The medians of every 5 elements are gathered at the front and their median is selected recursively,
+                 * so at least 30% of the elements are on each side of the pivot.
+                 * @brief Chooses a pivot with the median-of-medians and moves it to <code>elements[start]</code>.
+                 * @param elements The array of elements to be partitioned.
+                 * @param start The index of the first element to be partitioned.
+                 * @param end The index of the first element not to be partitioned after <code>start</code>, at least <code>start + GROUP_LENGTH</code>.
+                 * @param compare The comparator of elements.
+                 */
+                template<typename T, typename Compare>
+                void choose_median_of_medians_pivot(T *const elements, const size_t start, const size_t end, const Compare &compare) {
+                    size_t medians_end = start;
+                    for (size_t group = start; group + GROUP_LENGTH <= end; group += GROUP_LENGTH) {
+                        insertion_sort(elements, group, group + GROUP_LENGTH, compare);
+                        utility::swap(elements[medians_end], elements[group + GROUP_LENGTH / 2]);
+                        ++medians_end;
+                    }
+
+                    const size_t median = start + (medians_end - start) / 2;
+                    select(elements, start, median, medians_end, 0, compare); // no work allowed, so the medians are selected in linear time
+                    if (median != start) {
+                        utility::swap(elements[start], elements[median]);
+                    }
+                }
+
+                /**
+                 * Pivots are chosen as in quick sort until <code>work</code> runs out,
+                 * and by the median-of-medians afterwards, so the worst case is O(n) time.
+                 * @brief Rearranges an array so that <code>elements[nth]</code> is the element which would be there if sorted.
+                 * @param elements The array of elements to be rearranged.
+                 * @param start The index of the first element to be rearranged.
+                 * @param nth The index of the element to be selected, in <code>[ start : end )</code>.
+                 * @param end The index of the first element not to be rearranged after <code>start</code>.
+                 * @param work The number of elements left to be partitioned with quick sort pivots.
+                 * @param compare The comparator of elements.
+                 */
+                template<typename T, typename Compare>
+                void select(T *const elements, size_t start, const size_t nth, size_t end, size_t work, const Compare &compare) {
+                    while (end - start > INSERTION_SORT_THRESHOLD) {
+                        const size_t length = end - start;
+                        if (work >= length) {
+                            work -= length;
+                            _quick_sort::choose_pivot(elements, start, end, compare);
+                        } else {
+                            work = 0;
+                            choose_median_of_medians_pivot(elements, start, end, compare);
+                        }
+
+                        const size_t pivot_position = _quick_sort::partition(elements, start, end, compare);
+                        if (nth == pivot_position) {
+                            return;
+                        }
+                        if (nth < pivot_position) {
+                            end = pivot_position;
+                        } else {
+                            start = pivot_position + 1;
+                        }
+                    }
+                    insertion_sort(elements, start, end, compare);
+                }
+            }
+            /**
+             * This is an introselect: quickselect with quick sort's pivots, falling back to the median-of-medians
+             * when the partitioning does not converge, so the worst case is O(n) time.
+             * After this function returns, no element before <code>nth</code> is greater than <code>elements[nth]</code>,
+             * and no element after it is less than <code>elements[nth]</code>.
+             * @brief Puts the element which would be at <code>nth</code> if the array were sorted there.
+             * @param T The type of elements to be rearranged.
+             * @param elements The array of elements to be rearranged.  This same array will be rearranged after this function returns.
+             * @param start The index of the first element to be rearranged.
+             * @param nth The index of the element to be selected.  Nothing is done if it is not in <code>[ start : end )</code>.
+             * @param end The index of the first element not to be rearranged after <code>start</code>.
+             * @param compare The comparator returning whether its first argument goes before its second.  It is <code>operator&lt;</code> by default.
+             */
+            template<typename T, typename Compare = utility::Less>
+            inline void nth_element(T *const elements, const size_t start, const size_t nth, const size_t end, Compare compare = Compare()) {
+                if (start + 1 >= end || nth < start || nth >= end) {
+                    return;
+                }
+
+                _nth_element::select(elements, start, nth, end, (end - start) * _nth_element::WORK_LIMIT_FACTOR, compare);
+            }
+        }
+    }
+}
+
+#endif // #ifndef YH_ALGO_SORT_NTH_ELEMENT_H
\ No newline at end of file
@@ -0,0 +1,267 @@
+/**
+ * @file parallel_merge_sort.h The parallel merge sort implementation in C++.
+ * 
+ * @copyright Copyright (c) 2025 YH Choi. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef YH_ALGO_SORT_PARALLEL_MERGE_SORT_H
+#define YH_ALGO_SORT_PARALLEL_MERGE_SORT_H
+
+#ifndef ARDUINO
+
+#include <cstddef>
+
+#include "../../utility/functional.h"
+#include "../../utility/move.h"
+#include "_thread_pool.h"
+#include "merge_sort.h"
+
+namespace yh {
+    namespace algo {
+        namespace sort {
+            namespace _parallel_merge_sort {
+                /**
+                 * @brief The default minimum number of elements given to a thread.
+                 */
+                static const size_t DEFAULT_GRAIN_SIZE = 16384U;
+
+                /**
+                 * Taking <code>i</code> elements from <code>lhs</code> and <code>diagonal - i</code> elements from <code>rhs</code>
+                 * gives exactly the first <code>diagonal</code> elements of the stable merge.
+                 * @brief Finds where a diagonal of the merge path crosses the left run.
+                 * @param lhs The left run.
+                 * @param lhsLength The length of the left run.
+                 * @param rhs The right run.
+                 * @param rhsLength The length of the right run.
+                 * @param diagonal The number of merged elements [ 0 : lhsLength + rhsLength ].
+                 * @param compare The comparator of elements.
+                 * @return The number of elements taken from the left run.
+                 */
+                template<typename T, typename Compare>
+                inline size_t merge_path(const T *const lhs, const size_t lhsLength, const T *const rhs, const size_t rhsLength, const size_t diagonal, const Compare &compare) {
+                    size_t low = (diagonal > rhsLength) ? diagonal - rhsLength : 0;
+                    size_t high = (diagonal < lhsLength) ? diagonal : lhsLength;
+                    while (low < high) {
+                        const size_t mid = low + (high - low) / 2;
+                        if (!compare(rhs[diagonal - mid - 1], lhs[mid])) { // lhs[mid] goes before rhs[diagonal - mid - 1]
+                            low = mid + 1;
+                        } else {
+                            high = mid;
+                        }
+                    }
+                    return low;
+                }
+
+                /**
+                 * @brief Sorts a chunk sequentially.
+                 */
+                template<typename T, typename Compare>
+                struct SortTask {
+                    T *elements;
+                    T *buffer;
+                    size_t length;
+                    const Compare *compare;
+
+                    void operator()() {
+                        _merge_sort::bottom_up_merge_sort(elements, buffer, length, *compare);
+                    }
+                };
+
+                /**
+                 * The split points are found before any task runs,
+                 * because the tasks move elements out of the runs that other tasks would search.
+                 * @brief Merges the parts of 2 runs between 2 diagonals of their merge path.
+                 */
+                template<typename T, typename Compare>
+                struct MergeTask {
+                    T *lhs;
+                    T *lhsEnd;
+                    T *rhs;
+                    T *rhsEnd;
+                    T *destination;
+                    const Compare *compare;
+
+                    void operator()() {
+                        _merge_sort::merge(lhs, lhsEnd, rhs, rhsEnd, destination, *compare);
+                    }
+                };
+
+                /**
+                 * @brief Moves a part of an array.
+                 */
+                template<typename T>
+                struct MoveTask {
+                    T *source;
+                    T *destination;
+                    size_t length;
+
+                    void operator()() {
+                        utility::move_forward(source, destination, length);
+                    }
+                };
+
+                /**
+                 * The chunks are sorted concurrently, then every round merges adjacent pairs of runs,
+                 * splitting each merge along its merge path so that every thread gets an equal share
+                 * even when only 1 pair of runs is left.
+                 * @brief Sorts an array with parallel merge sort.
+                 * @param pool The thread pool running the tasks.
+                 * @param elements The first element to be sorted.
+                 * @param buffer The scratch space of at least <code>length</code> elements.
+                 * @param length The number of elements to be sorted.
+                 * @param chunkCount The number of chunks to be sorted concurrently.
+                 * @param compare The comparator of elements, shared by all threads.
+                 */
+                template<typename T, typename Compare>
+                void parallel_merge_sort(_thread_pool::ThreadPool &pool, T *const elements, T *const buffer, const size_t length, const size_t chunkCount, const Compare &compare) {
+                    // the boundaries of the sorted runs
+                    size_t *bounds = new size_t [chunkCount + 1];
+                    size_t *nextBounds = new size_t [chunkCount + 1];
+                    for (size_t i = 0; i <= chunkCount; ++i) {
+                        bounds[i] = length / chunkCount * i + ((i < length % chunkCount) ? i : length % chunkCount);
+                    }
+
+                    // sort the chunks concurrently
+                    SortTask<T, Compare> *const sortTasks = new SortTask<T, Compare> [chunkCount];
+                    for (size_t i = 0; i < chunkCount; ++i) {
+                        sortTasks[i].elements = elements + bounds[i];
+                        sortTasks[i].buffer = buffer + bounds[i];
+                        sortTasks[i].length = bounds[i + 1] - bounds[i];
+                        sortTasks[i].compare = &compare;
+                    }
+                    pool.run(sortTasks, chunkCount);
+                    delete[] sortTasks;
+
+                    // merge adjacent pairs of runs until 1 run is left
+                    const size_t threadCount = pool.size();
+                    const size_t partLength = (length + threadCount - 1) / threadCount;
+                    MergeTask<T, Compare> *const mergeTasks = new MergeTask<T, Compare> [chunkCount + threadCount];
+                    T *source = elements;
+                    T *destination = buffer;
+                    size_t runCount = chunkCount;
+                    while (runCount > 1) {
+                        size_t taskCount = 0;
+                        size_t nextRunCount = 0;
+                        for (size_t run = 0; run < runCount; run += 2) {
+                            const size_t lhsBegin = bounds[run];
+                            const size_t rhsBegin = bounds[run + 1];
+                            const size_t rhsEnd = (run + 2 <= runCount) ? bounds[run + 2] : rhsBegin;
+                            const size_t pairLength = rhsEnd - lhsBegin;
+                            const size_t partCount = (pairLength + partLength - 1) / partLength;
+                            T *const lhs = source + lhsBegin;
+                            T *const rhs = source + rhsBegin;
+                            size_t lhsSplit = 0;
+                            for (size_t part = 0; part < partCount; ++part) {
+                                const size_t diagonalBegin = part * partLength;
+                                const size_t diagonalEnd = (part + 1 < partCount) ? (part + 1) * partLength : pairLength;
+                                const size_t lhsSplitEnd = merge_path(lhs, rhsBegin - lhsBegin, rhs, rhsEnd - rhsBegin, diagonalEnd, compare);
+                                MergeTask<T, Compare> &task = mergeTasks[taskCount];
+                                task.lhs = lhs + lhsSplit;
+                                task.lhsEnd = lhs + lhsSplitEnd;
+                                task.rhs = rhs + (diagonalBegin - lhsSplit);
+                                task.rhsEnd = rhs + (diagonalEnd - lhsSplitEnd);
+                                task.destination = destination + lhsBegin + diagonalBegin;
+                                task.compare = &compare;
+                                lhsSplit = lhsSplitEnd;
+                                ++taskCount;
+                            }
+                            nextBounds[nextRunCount] = lhsBegin;
+                            ++nextRunCount;
+                        }
+                        nextBounds[nextRunCount] = length;
+                        pool.run(mergeTasks, taskCount);
+
+                        size_t *const tempBounds = bounds;
+                        bounds = nextBounds;
+                        nextBounds = tempBounds;
+                        runCount = nextRunCount;
+                        T *const temp = source;
+                        source = destination;
+                        destination = temp;
+                    }
+                    delete[] mergeTasks;
+                    delete[] nextBounds;
+                    delete[] bounds;
+
+                    // move the sorted elements from buffer[] back to elements[]
+                    if (source != elements) {
+                        MoveTask<T> *const moveTasks = new MoveTask<T> [threadCount];
+                        size_t taskCount = 0;
+                        for (size_t begin = 0; begin < length; begin += partLength) {
+                            moveTasks[taskCount].source = source + begin;
+                            moveTasks[taskCount].destination = elements + begin;
+                            moveTasks[taskCount].length = (length - begin > partLength) ? partLength : length - begin;
+                            ++taskCount;
+                        }
+                        pool.run(moveTasks, taskCount);
+                        delete[] moveTasks;
+                    }
+                }
+            }
+            /**
+             * The sort is stable.  Ranges shorter than 2 grains are sorted by the sequential merge sort on the calling thread.
+             * A scratch buffer of <code>end - start</code> elements is allocated once.
+             * @brief Sorts an array with merge sort on multiple threads.
+             * @param T The type of elements to be sorted.
+             * @param elements The array of elements to be sorted.  This same array will be sorted after this function returns.
+             * @param start The index of the first element to be sorted.
+             * @param end The index of the first element not to be sorted after <code>start</code>.
+             * @param maxThreads The maximum number of threads to be used, or 0 to use 1 thread per processor.
+             * @param grainSize The minimum number of elements given to a thread.
+             * @param compare The comparator returning whether its first argument goes before its second.  It is <code>operator&lt;</code> by default, and is called from multiple threads at once.
+             * @note Only available when <code>ARDUINO</code> is not defined.
+             */
+            template<typename T, typename Compare = utility::Less>
+            inline void parallel_merge_sort(T *const elements, const size_t start, const size_t end, const size_t maxThreads = 0, const size_t grainSize = _parallel_merge_sort::DEFAULT_GRAIN_SIZE, Compare compare = Compare()) {
+                if (start + 1 >= end) {
+                    return;
+                }
+
+                const size_t toSortLength = end - start;
+                const size_t grainCount = toSortLength / ((grainSize > 0) ? grainSize : 1);
+                size_t threadCount = (maxThreads > 0) ? maxThreads : _thread_pool::hardware_concurrency();
+                if (threadCount > grainCount) {
+                    threadCount = grainCount;
+                }
+                if (threadCount <= 1) {
+                    merge_sort(elements, start, end, compare);
+                    return;
+                }
+
+                T *const buffer = new T[toSortLength];
+                _thread_pool::ThreadPool pool(threadCount);
+                _parallel_merge_sort::parallel_merge_sort(pool, elements + start, buffer, toSortLength, pool.size(), compare);
+                delete[] buffer;
+            }
+        }
+    }
+}
+
+#endif // #ifndef ARDUINO
+
+#endif // #ifndef YH_ALGO_SORT_PARALLEL_MERGE_SORT_H
\ No newline at end of file
@@ -0,0 +1,81 @@
+/**
+ * @file partial_sort.h The partial sort implementation in C++.
+ * 
+ * @copyright Copyright (c) 2025 YH Choi. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef YH_ALGO_SORT_PARTIAL_SORT_H
+#define YH_ALGO_SORT_PARTIAL_SORT_H
+
+#ifdef ARDUINO
+#include <stddef.h>
+#else
+#include <cstddef>
+#endif
+
+#include "../../utility/functional.h"
+#include "../../utility/move.h"
+#include "heap_sort.h"
+
+namespace yh {
+    namespace algo {
+        namespace sort {
+            /**
+             * The smallest elements are kept in a max heap of <code>middle - start</code> elements,
+             * whose top is replaced whenever a smaller element is found, so this takes O(n log k) time and no extra memory.
+             * The order of the elements after <code>middle</code> is unspecified.  This sort is not stable.
+             * @brief Sorts the smallest <code>middle - start</code> elements of an array into <code>[ start : middle )</code>.
+             * @param T The type of elements to be sorted.
+             * @param elements The array of elements to be sorted.  This same array will be partially sorted after this function returns.
+             * @param start The index of the first element to be sorted.
+             * @param middle The index of the first element not to be sorted after <code>start</code>, in <code>[ start : end ]</code>.
+             * @param end The index of the first element not to be considered after <code>middle</code>.
+             * @param compare The comparator returning whether its first argument goes before its second.  It is <code>operator&lt;</code> by default.
+             */
+            template<typename T, typename Compare = utility::Less>
+            inline void partial_sort(T *const elements, const size_t start, const size_t middle, const size_t end, Compare compare = Compare()) {
+                if (middle <= start || middle > end) {
+                    return;
+                }
+
+                T *const heap = elements + start;
+                const size_t heapLength = middle - start;
+                _heap_sort::make_heap(heap, heapLength, compare);
+                for (size_t i = middle; i < end; ++i) {
+                    if (compare(elements[i], heap[0])) {
+                        utility::swap(heap[0], elements[i]);
+                        _heap_sort::sift_down(heap, 0, heapLength, compare);
+                    }
+                }
+                _heap_sort::sort_heap(heap, heapLength, compare);
+            }
+        }
+    }
+}
+
+#endif // #ifndef YH_ALGO_SORT_PARTIAL_SORT_H
\ No newline at end of file
@@ -0,0 +1,459 @@
+/**
+ * @file pdq_sort.h The pattern-defeating quick sort implementation in C++.
+ * 
+ * @copyright Copyright (c) 2025 YH Choi. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef YH_ALGO_SORT_PDQ_SORT_H
+#define YH_ALGO_SORT_PDQ_SORT_H
+
+#ifdef ARDUINO
+#include <stddef.h>
+#else
+#include <cstddef>
+#endif
+
+#include "../../utility/functional.h"
+#include "../../utility/move.h"
+#include "heap_sort.h"
+
+namespace yh {
+    namespace algo {
+        namespace sort {
+            namespace _pdq_sort {
+                /**
+                 * @brief Partitions shorter than this are sorted with insertion sort.
+                 */
+                static const size_t INSERTION_SORT_THRESHOLD = 24U;
+
+                /**
+                 * @brief Partitions longer than this choose their pivots with Tukey's ninther instead of median-of-three.
+                 */
+                static const size_t NINTHER_THRESHOLD = 128U;
+
+                /**
+                 * @brief The number of element moves after which a partial insertion sort gives up.
+                 */
+                static const size_t PARTIAL_INSERTION_SORT_LIMIT = 8U;
+
+                /**
+                 * @brief The number of elements classified into an offset buffer at a time.  It must fit in an unsigned char.
+                 */
+                static const size_t BLOCK_SIZE = 64U;
+
+                /**
+                 * @brief Sorts 2 elements.
+                 */
+                template<typename T, typename Compare>
+                inline void sort2(T *const a, T *const b, const Compare &compare) {
+                    if (compare(*b, *a)) {
+                        utility::swap(*a, *b);
+                    }
+                }
+
+                /**
+                 * @brief Sorts 3 elements.
+                 */
+                template<typename T, typename Compare>
+                inline void sort3(T *const a, T *const b, T *const c, const Compare &compare) {
+                    sort2(a, b, compare);
+                    sort2(b, c, compare);
+                    sort2(a, b, compare);
+                }
+
+                /**
+                 * @brief Sorts <code>[begin : end)</code> with insertion sort.
+                 */
+                template<typename T, typename Compare>
+                inline void insertion_sort(T *const begin, T *const end, const Compare &compare) {
+                    if (begin == end) {
+                        return;
+                    }
+                    for (T *current = begin + 1; current < end; ++current) {
+                        T *hole = current;
+                        T *previous = current - 1;
+                        if (compare(*hole, *previous)) {
+                            T element = utility::move(*hole);
+                            do {
+                                (*hole) = utility::move(*previous);
+                                --hole;
+                            } while (hole != begin && compare(element, *(--previous)));
+                            (*hole) = utility::move(element);
+                        }
+                    }
+                }
+
+                /**
+                 * @brief Sorts <code>[begin : end)</code> with insertion sort, given that <code>*(begin - 1)</code> is not greater than any of them.
+                 */
+                template<typename T, typename Compare>
+                inline void unguarded_insertion_sort(T *const begin, T *const end, const Compare &compare) {
+                    if (begin == end) {
+                        return;
+                    }
+                    for (T *current = begin + 1; current < end; ++current) {
+                        T *hole = current;
+                        T *previous = current - 1;
+                        if (compare(*hole, *previous)) {
+                            T element = utility::move(*hole);
+                            do {
+                                (*hole) = utility::move(*previous);
+                                --hole;
+                            } while (compare(element, *(--previous))); // stops at *(begin - 1) at the latest
+                            (*hole) = utility::move(element);
+                        }
+                    }
+                }
+
+                /**
+                 * @brief Tries to sort <code>[begin : end)</code> with insertion sort, giving up after a few element moves.
+                 * @return true if the elements are sorted, false if it gave up.
+                 */
+                template<typename T, typename Compare>
+                inline bool partial_insertion_sort(T *const begin, T *const end, const Compare &compare) {
+                    if (begin == end) {
+                        return true;
+                    }
+                    size_t moves = 0;
+                    for (T *current = begin + 1; current < end; ++current) {
+                        T *hole = current;
+                        T *previous = current - 1;
+                        if (compare(*hole, *previous)) {
+                            T element = utility::move(*hole);
+                            do {
+                                (*hole) = utility::move(*previous);
+                                --hole;
+                            } while (hole != begin && compare(element, *(--previous)));
+                            (*hole) = utility::move(element);
+                            moves += (size_t)(current - hole);
+                            if (moves > PARTIAL_INSERTION_SORT_LIMIT) {
+                                return false;
+                            }
+                        }
+                    }
+                    return true;
+                }
+
+                /**
+                 * When both buffers are equally full, the elements are swapped pairwise,
+                 * otherwise they are rotated through a cycle with fewer moves.
+                 * @brief Swaps elements on the wrong sides recorded in the offset buffers.
+                 * @param leftBase The element that left offsets are relative to.
+                 * @param rightBase The element that right offsets are relative to (backwards).
+                 * @param leftOffsets The offsets of misplaced elements on the left.
+                 * @param rightOffsets The offsets of misplaced elements on the right.
+                 * @param count The number of pairs to be swapped.
+                 * @param useSwaps Whether to swap pairwise.
+                 */
+                template<typename T>
+                inline void swap_offsets(T *const leftBase, T *const rightBase, const unsigned char *const leftOffsets, const unsigned char *const rightOffsets, const size_t count, const bool useSwaps) {
+                    if (useSwaps) {
+                        // needed for descending inputs to keep the partitioning linear
+                        for (size_t i = 0; i < count; ++i) {
+                            utility::swap(*(leftBase + leftOffsets[i]), *(rightBase - rightOffsets[i]));
+                        }
+                    } else if (count > 0) {
+                        T *left = leftBase + leftOffsets[0];
+                        T *right = rightBase - rightOffsets[0];
+                        T temp = utility::move(*left);
+                        (*left) = utility::move(*right);
+                        for (size_t i = 1; i < count; ++i) {
+                            left = leftBase + leftOffsets[i];
+                            (*right) = utility::move(*left);
+                            right = rightBase - rightOffsets[i];
+                            (*left) = utility::move(*right);
+                        }
+                        (*right) = utility::move(temp);
+                    }
+                }
+
+                /**
+                 * The comparisons only increment buffer indices instead of branching (BlockQuicksort),
+                 * so random inputs do not cause branch mispredictions.
+                 * Elements equal to the pivot go to the right partition.
+                 * @brief Partitions <code>[begin : end)</code> around the pivot at <code>*begin</code> without branching on comparisons.
+                 * @param begin The first element, which is the pivot.  There must be an element not less than the pivot after it.
+                 * @param end The element after the last element.
+                 * @param alreadyPartitioned Set to whether no element needed to be moved.
+                 * @return The final position of the pivot.
+                 */
+                template<typename T, typename Compare>
+                T *partition_right_branchless(T *const begin, T *const end, bool &alreadyPartitioned, const Compare &compare) {
+                    T pivot = utility::move(*begin); // *begin is never read again until the pivot is put back
+                    T *first = begin;
+                    T *last = end;
+
+                    // find the first element not less than the pivot (the median guarantees it exists)
+                    do {
+                        ++first;
+                    } while (compare(*first, pivot));
+
+                    // find the last element less than the pivot, guarded if nothing was skipped before first
+                    if (first - 1 == begin) {
+                        while (first < last && !(compare(*(--last), pivot)));
+                    } else {
+                        while (!(compare(*(--last), pivot)));
+                    }
+
+                    alreadyPartitioned = first >= last;
+                    if (!alreadyPartitioned) {
+                        utility::swap(*first, *last);
+                        ++first;
+
+                        alignas(64) unsigned char leftOffsets [BLOCK_SIZE];
+                        alignas(64) unsigned char rightOffsets [BLOCK_SIZE];
+                        T *leftBase = first;
+                        T *rightBase = last;
+                        size_t leftCount = 0;
+                        size_t rightCount = 0;
+                        size_t leftStart = 0;
+                        size_t rightStart = 0;
+
+                        while (first < last) {
+                            // refill the empty offset buffers, splitting the unknown elements between them
+                            const size_t unknownCount = (size_t)(last - first);
+                            const size_t leftSplit = (leftCount == 0) ? ((rightCount == 0) ? unknownCount / 2 : unknownCount) : 0;
+                            const size_t rightSplit = (rightCount == 0) ? (unknownCount - leftSplit) : 0;
+
+                            const size_t leftBlock = (leftSplit < BLOCK_SIZE) ? leftSplit : BLOCK_SIZE;
+                            for (size_t i = 0; i < leftBlock; ++i) {
+                                leftOffsets[leftCount] = (unsigned char)i;
+                                leftCount += (size_t)!(compare(*first, pivot));
+                                ++first;
+                            }
+                            const size_t rightBlock = (rightSplit < BLOCK_SIZE) ? rightSplit : BLOCK_SIZE;
+                            for (size_t i = 1; i <= rightBlock; ++i) {
+                                rightOffsets[rightCount] = (unsigned char)i;
+                                --last;
+                                rightCount += (size_t)(compare(*last, pivot));
+                            }
+
+                            // swap the misplaced elements and forget the exhausted buffers
+                            const size_t count = (leftCount < rightCount) ? leftCount : rightCount;
+                            swap_offsets(leftBase, rightBase, leftOffsets + leftStart, rightOffsets + rightStart, count, leftCount == rightCount);
+                            leftCount -= count;
+                            rightCount -= count;
+                            leftStart += count;
+                            rightStart += count;
+                            if (leftCount == 0) {
+                                leftStart = 0;
+                                leftBase = first;
+                            }
+                            if (rightCount == 0) {
+                                rightStart = 0;
+                                rightBase = last;
+                            }
+                        }
+
+                        // move the remaining misplaced elements next to the boundary
+                        if (leftCount > 0) {
+                            const unsigned char *const offsets = leftOffsets + leftStart;
+                            while (leftCount > 0) {
+                                --leftCount;
+                                --last;
+                                utility::swap(*(leftBase + offsets[leftCount]), *last);
+                            }
+                            first = last;
+                        }
+                        if (rightCount > 0) {
+                            const unsigned char *const offsets = rightOffsets + rightStart;
+                            while (rightCount > 0) {
+                                --rightCount;
+                                utility::swap(*(rightBase - offsets[rightCount]), *first);
+                                ++first;
+                            }
+                            last = first;
+                        }
+                    }
+
+                    // put the pivot to the middle of the partition
+                    T *const pivotPosition = first - 1;
+                    (*begin) = utility::move(*pivotPosition);
+                    (*pivotPosition) = utility::move(pivot);
+                    return pivotPosition;
+                }
+
+                /**
+                 * This is used when the pivot equals the element before the range, which is not greater than any of them:
+                 * all elements equal to the pivot are gathered on the left and need no further sorting.
+                 * @brief Partitions <code>[begin : end)</code> around the pivot at <code>*begin</code>, putting elements equal to the pivot on the left.
+                 * @return The final position of the pivot.
+                 */
+                template<typename T, typename Compare>
+                T *partition_left(T *const begin, T *const end, const Compare &compare) {
+                    const T &pivot = (*begin); // stays in place until the end, and stops the first scan at the latest
+                    T *first = begin;
+                    T *last = end;
+
+                    while (compare(pivot, *(--last)));
+                    if (last + 1 == end) {
+                        while (first < last && !(compare(pivot, *(++first))));
+                    } else {
+                        while (!(compare(pivot, *(++first))));
+                    }
+
+                    while (first < last) {
+                        utility::swap(*first, *last);
+                        while (compare(pivot, *(--last)));
+                        while (!(compare(pivot, *(++first))));
+                    }
+
+                    if (last != begin) {
+                        utility::swap(*begin, *last);
+                    }
+                    return last;
+                }
+
+                /**
+                 * @brief Sorts <code>[begin : end)</code> with pattern-defeating quick sort.
+                 * @param begin The first element to be sorted.
+                 * @param end The element after the last element to be sorted.
+                 * @param badAllowed The number of highly unbalanced partitions allowed before falling back to heap sort.
+                 * @param leftmost Whether there is no element before <code>begin</code> that is not greater than all of the range.
+                 */
+                template<typename T, typename Compare>
+                void pdq_sort_loop(T *begin, T *const end, size_t badAllowed, bool leftmost, const Compare &compare) {
+                    while (true) {
+                        const size_t size = (size_t)(end - begin);
+                        if (size < INSERTION_SORT_THRESHOLD) {
+                            if (leftmost) {
+                                insertion_sort(begin, end, compare);
+                            } else {
+                                unguarded_insertion_sort(begin, end, compare);
+                            }
+                            return;
+                        }
+
+                        // move the median of 3 or the pseudomedian of 9 to *begin
+                        const size_t half = size / 2;
+                        if (size > NINTHER_THRESHOLD) {
+                            sort3(begin, begin + half, end - 1, compare);
+                            sort3(begin + 1, begin + (half - 1), end - 2, compare);
+                            sort3(begin + 2, begin + (half + 1), end - 3, compare);
+                            sort3(begin + (half - 1), begin + half, begin + (half + 1), compare);
+                            utility::swap(*begin, *(begin + half));
+                        } else {
+                            sort3(begin + half, begin, end - 1, compare);
+                        }
+
+                        // many equal elements: the pivot equals the greatest element on the left, so only the greater ones remain
+                        if (!leftmost && !(compare(*(begin - 1), *begin))) {
+                            begin = partition_left(begin, end, compare) + 1;
+                            continue;
+                        }
+
+                        bool alreadyPartitioned;
+                        T *const pivotPosition = partition_right_branchless(begin, end, alreadyPartitioned, compare);
+
+                        const size_t leftSize = (size_t)(pivotPosition - begin);
+                        const size_t rightSize = (size_t)(end - (pivotPosition + 1));
+                        const bool highlyUnbalanced = leftSize < size / 8 || rightSize < size / 8;
+
+                        if (highlyUnbalanced) {
+                            // too many bad partitions: fall back to heap sort for the O(n log n) guarantee
+                            --badAllowed;
+                            if (badAllowed == 0) {
+                                heap_sort(begin, 0, size, compare);
+                                return;
+                            }
+
+                            // shuffle some elements to break the pattern
+                            if (leftSize >= INSERTION_SORT_THRESHOLD) {
+                                utility::swap(*begin, *(begin + leftSize / 4));
+                                utility::swap(*(pivotPosition - 1), *(pivotPosition - leftSize / 4));
+                                if (leftSize > NINTHER_THRESHOLD) {
+                                    utility::swap(*(begin + 1), *(begin + (leftSize / 4 + 1)));
+                                    utility::swap(*(begin + 2), *(begin + (leftSize / 4 + 2)));
+                                    utility::swap(*(pivotPosition - 2), *(pivotPosition - (leftSize / 4 + 1)));
+                                    utility::swap(*(pivotPosition - 3), *(pivotPosition - (leftSize / 4 + 2)));
+                                }
+                            }
+                            if (rightSize >= INSERTION_SORT_THRESHOLD) {
+                                utility::swap(*(pivotPosition + 1), *(pivotPosition + (1 + rightSize / 4)));
+                                utility::swap(*(end - 1), *(end - rightSize / 4));
+                                if (rightSize > NINTHER_THRESHOLD) {
+                                    utility::swap(*(pivotPosition + 2), *(pivotPosition + (2 + rightSize / 4)));
+                                    utility::swap(*(pivotPosition + 3), *(pivotPosition + (3 + rightSize / 4)));
+                                    utility::swap(*(end - 2), *(end - (1 + rightSize / 4)));
+                                    utility::swap(*(end - 3), *(end - (2 + rightSize / 4)));
+                                }
+                            }
+                        } else if (
+                            alreadyPartitioned &&
+                            partial_insertion_sort(begin, pivotPosition, compare) &&
+                            partial_insertion_sort(pivotPosition + 1, end, compare)
+                        ) {
+                            // the range was (nearly) sorted already
+                            return;
+                        }
+
+                        // recurse on the left partition and loop on the right partition
+                        pdq_sort_loop(begin, pivotPosition, badAllowed, leftmost, compare);
+                        begin = pivotPosition + 1;
+                        leftmost = false;
+                    }
+                }
+
+                /**
+                 * @brief Gets <code>floor(log2(length))</code>.
+                 */
+                inline size_t log2(size_t length) {
+                    size_t log = 0;
+                    while (length > 1) {
+                        length /= 2;
+                        ++log;
+                    }
+                    return log;
+                }
+            }
+            /**
+             * Pattern-defeating quick sort partitions with BlockQuicksort's branchless offset buffers,
+             * detects already sorted partitions, shuffles elements after bad partitions,
+             * gathers runs of elements equal to the pivot in 1 pass,
+             * and falls back to heap sort after <code>log2(end - start)</code> bad partitions.
+             * It is fastest for cheap comparisons, such as those of integers and floating point numbers.
+             * @brief Sorts an array with pattern-defeating quick sort.
+             * @param T The type of elements to be sorted.
+             * @param elements The array of elements to be sorted.  This same array will be sorted after this function returns.
+             * @param start The index of the first element to be sorted.
+             * @param end The index of the first element not to be sorted after <code>start</code>.
+             * @param compare The comparator returning whether its first argument goes before its second.  It is <code>operator&lt;</code> by default.
+             */
+            template<typename T, typename Compare = utility::Less>
+            inline void pdq_sort(T *const elements, const size_t start, const size_t end, Compare compare = Compare()) {
+                if (start + 1 >= end) {
+                    return;
+                }
+
+                _pdq_sort::pdq_sort_loop(elements + start, elements + end, _pdq_sort::log2(end - start), true, compare);
+            }
+        }
+    }
+}
+
+#endif // #ifndef YH_ALGO_SORT_PDQ_SORT_H
\ No newline at end of file
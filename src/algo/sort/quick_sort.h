@@ -38,54 +38,181 @@
 #include <cstddef>
 #endif
 
+#include "../../utility/functional.h"
+#include "../../utility/move.h"
+#include "../../utility/type_traits.h"
+#include "heap_sort.h"
+#include "insertion_sort.h"
+#include "sorting_network.h"
+
 namespace yh {
     namespace algo {
         namespace sort {
             namespace _quick_sort {
-                template<typename T>
-                inline void swap(T &lhs, T &rhs) {
-                    T temp = lhs; // copy lhs to temp
-                    lhs = rhs; // move rhs to lhs
-                    rhs = temp; // move temp to rhs
+                /**
+                 * @brief Partitions not longer than this are sorted with a sorting network for arithmetic types in ascending order, otherwise with insertion sort.
+                 */
+                static const size_t INSERTION_SORT_THRESHOLD = 16U;
+
+                /**
+                 * @brief Partitions longer than this choose their pivots with Tukey's ninther instead of median-of-three.
+                 */
+                static const size_t NINTHER_THRESHOLD = 128U;
+
+                /**
+                 * @brief Gets the median of 3 elements without moving them.
+                 * @return The pointer to the median element.
+                 */
+                template<typename T, typename Compare>
+                inline T *median_of_three(T *const a, T *const b, T *const c, const Compare &compare) {
+                    if (compare(*a, *b)) {
+                        if (compare(*b, *c)) {
+                            return b; // a < b < c
+                        }
+                        return compare(*a, *c) ? c : a; // a < c <= b, or c <= a < b
+                    }
+                    if (compare(*a, *c)) {
+                        return a; // b <= a < c
+                    }
+                    return compare(*b, *c) ? c : b; // b < c <= a, or c <= b <= a
+                }
+
+                /**
+                 * Median-of-three is used for short partitions and Tukey's ninther for long partitions,
+                 * so that sorted, reverse-sorted and organ-pipe inputs are split evenly.
+                 * @brief Chooses a pivot and moves it to <code>elements[start]</code>.
+                 * @param elements The array of elements to be partitioned.
+                 * @param start The index of the first element to be partitioned.
+                 * @param end The index of the first element not to be partitioned after <code>start</code>, at least <code>start + 3</code>.
+                 * @param compare The comparator of elements.
+                 */
+                template<typename T, typename Compare>
+                inline void choose_pivot(T *const elements, const size_t start, const size_t end, const Compare &compare) {
+                    const size_t length = end - start;
+                    T *const first = elements + start;
+                    T *const middle = first + length / 2;
+                    T *const last = elements + end - 1;
+
+                    T *pivot;
+                    if (length > NINTHER_THRESHOLD) {
+                        const size_t step = length / 8;
+                        pivot = median_of_three(
+                            median_of_three(first, first + step, first + step * 2, compare),
+                            median_of_three(middle - step, middle, middle + step, compare),
+                            median_of_three(last - step * 2, last - step, last, compare),
+                            compare
+                        );
+                    } else {
+                        pivot = median_of_three(first, middle, last, compare);
+                    }
+                    if (pivot != first) {
+                        utility::swap(*first, *pivot);
+                    }
+                }
+
+                /**
+                 * Elements equal to the pivot stop both scans and are swapped across,
+                 * so that runs of equal elements are still split evenly.
+                 * @brief Partitions an array around the pivot at <code>elements[start]</code> with Hoare's scheme.
+                 * @param elements The array of elements to be partitioned.
+                 * @param start The index of the pivot, which is the first element to be partitioned.
+                 * @param end The index of the first element not to be partitioned after <code>start</code>.
+                 * @param compare The comparator of elements.
+                 * @return The final index of the pivot.  No element before it is greater than the pivot, and no element after it is less than the pivot.
+                 */
+                template<typename T, typename Compare>
+                inline size_t partition(T *const elements, const size_t start, const size_t end, const Compare &compare) {
+                    T *const pivot = elements + start;
+                    T *const end_ptr = elements + end;
+                    T *i = pivot;
+                    T *j = end_ptr;
+
+                    while (true) {
+                        do {
+                            ++i;
+                        } while (i < end_ptr && compare(*i, *pivot));
+                        do {
+                            --j;
+                        } while (compare(*pivot, *j)); // stops at the pivot at the latest
+                        if (i >= j) {
+                            break;
+                        }
+                        utility::swap(*i, *j);
+                    }
+
+                    // put the pivot to the middle of the partition
+                    if (j != pivot) {
+                        utility::swap(*pivot, *j);
+                    }
+                    return (size_t)(j - elements);
+                }
+
+                /**
+                 * @brief Gets the number of partitioning levels allowed before falling back to heap sort.
+                 * @param length The number of elements to be sorted.
+                 * @return <code>2 * floor(log2(length))</code>.
+                 */
+                inline size_t depth_limit(size_t length) {
+                    size_t depth = 0;
+                    while (length > 1) {
+                        length /= 2;
+                        depth += 2;
+                    }
+                    return depth;
+                }
+
+                /**
+                 * Only the shorter partition is sorted recursively while the longer one is sorted by the loop,
+                 * so the stack depth never exceeds <code>log2(end - start)</code>.
+                 * @brief Sorts an array with introsort.
+                 * @param elements The array of elements to be sorted.
+                 * @param start The index of the first element to be sorted.
+                 * @param end The index of the first element not to be sorted after <code>start</code>.
+                 * @param depth The number of partitioning levels left before falling back to heap sort.
+                 * @param compare The comparator of elements.
+                 */
+                template<typename T, typename Compare>
+                void introsort(T *const elements, size_t start, size_t end, size_t depth, const Compare &compare) {
+                    while (end - start > INSERTION_SORT_THRESHOLD) {
+                        if (depth == 0) {
+                            heap_sort(elements, start, end, compare);
+                            return;
+                        }
+                        --depth;
+
+                        choose_pivot(elements, start, end, compare);
+                        const size_t pivot_position = partition(elements, start, end, compare);
+
+                        if (pivot_position - start < end - pivot_position) {
+                            introsort(elements, start, pivot_position, depth, compare);
+                            start = pivot_position + 1;
+                        } else {
+                            introsort(elements, pivot_position + 1, end, depth, compare);
+                            end = pivot_position;
+                        }
+                    }
+                    _sorting_network::SmallSort<utility::IsArithmetic<T>::VALUE && utility::IsSame<Compare, utility::Less>::VALUE>::sort(elements, start, end, compare);
                 }
             }
             /**
+             * This is an introsort: pivots are chosen by median-of-three (or Tukey's ninther for long partitions),
+             * short partitions are finished with a sorting network (arithmetic types, default order) or insertion sort,
+             * and heap sort takes over when the partitioning goes deeper than <code>2 * log2(end - start)</code> levels.
+             * The worst case is O(n log n) time with O(log n) stack.
              * @brief Sorts an array with quick sort.
              * @param T The type of elements to be sorted.
              * @param elements The array of elements to be sorted.  This same array will be sorted after this function returns.
              * @param start The index of the first element to be sorted.
              * @param end The index of the first element not to be sorted after <code>start</code>.
+             * @param compare The comparator returning whether its first argument goes before its second.  It is <code>operator&lt;</code> by default.
              */
-            template<typename T>
-            inline void quick_sort(T *const elements, const size_t start, const size_t end) {
+            template<typename T, typename Compare = utility::Less>
+            inline void quick_sort(T *const elements, const size_t start, const size_t end, Compare compare = Compare()) {
                 if (start + 1 >= end) {
                     return;
                 }
 
-                // set the last element as pivot
-                T *const pivot = elements + end - 1;
-
-
-                T *i = elements + start;
-                T *j = i - 1;
-
-                while (i < pivot) {
-                    if ((*i) < (*pivot)) {
-                        ++j;
-                        _quick_sort::swap<T>(*i, *j);
-                    }
-                    ++i;
-                }
-                
-                // put the pivot to the middle of the partition
-                ++j;
-                _quick_sort::swap<T>(*pivot, *j);
-
-                // j now points to the pivot
-                // sort the remaining partitions
-                const size_t j_position = (size_t)(j - elements);
-                quick_sort(elements, start, j_position);
-                quick_sort(elements, j_position + 1, end);
+                _quick_sort::introsort(elements, start, end, _quick_sort::depth_limit(end - start), compare);
             }
         }
     }
@@ -0,0 +1,319 @@
+/**
+ * @file radix_sort.h The radix sort implementation in C++.
+ * 
+ * @copyright Copyright (c) 2025 YH Choi. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef YH_ALGO_SORT_RADIX_SORT_H
+#define YH_ALGO_SORT_RADIX_SORT_H
+
+#ifdef ARDUINO
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#else
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#endif
+
+#include "../../utility/move.h"
+#include "../../utility/type_traits.h"
+
+namespace yh {
+    namespace algo {
+        namespace sort {
+            namespace _radix_sort {
+                /**
+                 * @brief The number of bits in a digit.
+                 */
+                static const unsigned int DIGIT_BITS = 8U;
+
+                /**
+                 * @brief The number of different values of a digit.
+                 */
+                static const size_t RADIX = (size_t)1 << DIGIT_BITS;
+
+                /**
+                 * @brief Maps a size in bytes to the unsigned integer type of that size.
+                 * @param SIZE The size in bytes.
+                 */
+                template<size_t SIZE>
+                struct UnsignedOfSize;
+
+                template<>
+                struct UnsignedOfSize<1> {
+                    typedef uint8_t Type;
+                };
+
+                template<>
+                struct UnsignedOfSize<2> {
+                    typedef uint16_t Type;
+                };
+
+                template<>
+                struct UnsignedOfSize<4> {
+                    typedef uint32_t Type;
+                };
+
+                template<>
+                struct UnsignedOfSize<8> {
+                    typedef uint64_t Type;
+                };
+
+                /**
+                 * @brief The order-preserving transform of an unsigned integer key, which is the key itself.
+                 * @param K The unsigned integer key type.
+                 */
+                template<typename K>
+                struct UnsignedKeyTraits {
+                    typedef typename UnsignedOfSize<sizeof(K)>::Type Bits;
+                    static const bool IS_SUPPORTED = true;
+
+                    static inline Bits to_bits(const K key) {
+                        return (Bits)key;
+                    }
+                };
+
+                /**
+                 * @brief The order-preserving transform of a two's complement signed integer key, which flips the sign bit.
+                 * @param K The signed integer key type.
+                 */
+                template<typename K>
+                struct SignedKeyTraits {
+                    typedef typename UnsignedOfSize<sizeof(K)>::Type Bits;
+                    static const bool IS_SUPPORTED = true;
+
+                    static inline Bits to_bits(const K key) {
+                        return ((Bits)key) ^ ((Bits)1 << (sizeof(K) * 8 - 1));
+                    }
+                };
+
+                /**
+                 * Negative numbers have all bits flipped, so that a more negative number maps to a smaller integer,
+                 * while non-negative numbers only have the sign bit flipped, so that they map above all negative numbers.
+                 * NaNs are placed beyond the infinities according to their sign bits.
+                 * @brief The order-preserving transform of an IEEE 754 floating point key.
+                 * @param K The floating point key type.
+                 */
+                template<typename K>
+                struct FloatKeyTraits {
+                    typedef typename UnsignedOfSize<sizeof(K)>::Type Bits;
+                    static const bool IS_SUPPORTED = true;
+
+                    static inline Bits to_bits(const K key) {
+                        Bits bits;
+                        memcpy(&bits, &key, sizeof(K));
+                        const Bits signBit = (Bits)1 << (sizeof(K) * 8 - 1);
+                        return (bits & signBit) ? (Bits)~bits : (Bits)(bits ^ signBit);
+                    }
+                };
+
+                /**
+                 * Only integral and floating point types are supported, whose specializations have <code>IS_SUPPORTED</code> set.
+                 * @brief Maps a key to an unsigned integer of the same size whose order is the order of the keys.
+                 * @param K The key type.
+                 */
+                template<typename K>
+                struct KeyTraits {
+                    static const bool IS_SUPPORTED = false;
+                };
+
+                template<>
+                struct KeyTraits<char> {
+                    typedef uint8_t Bits;
+                    static const bool IS_SUPPORTED = true;
+
+                    static inline Bits to_bits(const char key) {
+                        // char may be signed or unsigned
+                        return ((char)-1 < 0) ? SignedKeyTraits<signed char>::to_bits((signed char)key) : (Bits)key;
+                    }
+                };
+
+                template<> struct KeyTraits<signed char> : SignedKeyTraits<signed char> {};
+                template<> struct KeyTraits<unsigned char> : UnsignedKeyTraits<unsigned char> {};
+                template<> struct KeyTraits<short> : SignedKeyTraits<short> {};
+                template<> struct KeyTraits<unsigned short> : UnsignedKeyTraits<unsigned short> {};
+                template<> struct KeyTraits<int> : SignedKeyTraits<int> {};
+                template<> struct KeyTraits<unsigned int> : UnsignedKeyTraits<unsigned int> {};
+                template<> struct KeyTraits<long> : SignedKeyTraits<long> {};
+                template<> struct KeyTraits<unsigned long> : UnsignedKeyTraits<unsigned long> {};
+                template<> struct KeyTraits<long long> : SignedKeyTraits<long long> {};
+                template<> struct KeyTraits<unsigned long long> : UnsignedKeyTraits<unsigned long long> {};
+                template<> struct KeyTraits<float> : FloatKeyTraits<float> {};
+                template<> struct KeyTraits<double> : FloatKeyTraits<double> {};
+
+                /**
+                 * @brief The key extractor which uses the element itself as the key.
+                 */
+                struct IdentityKey {
+                    template<typename T>
+                    inline const T &operator()(const T &element) const {
+                        return element;
+                    }
+                };
+
+                /**
+                 * All digit histograms are counted in a single read of the array,
+                 * and a digit is skipped when all keys share the same value of it.
+                 * The elements bounce between <code>elements</code> and <code>buffer</code> on every pass,
+                 * and are copied back to <code>elements</code> at most once at the end.
+                 * @brief Sorts an array with least significant digit radix sort.
+                 * @param elements The first element to be sorted.
+                 * @param buffer The scratch space of at least <code>length</code> elements.
+                 * @param length The number of elements to be sorted.
+                 * @param key The key extractor.
+                 */
+                template<typename T, typename KeyExtractor>
+                void lsd_radix_sort(T *const elements, T *const buffer, const size_t length, KeyExtractor key) {
+                    typedef typename utility::Decay<decltype(key(*elements))>::Type Key;
+                    typedef typename KeyTraits<Key>::Bits Bits;
+                    static const size_t DIGITS = sizeof(Bits) * 8 / DIGIT_BITS;
+
+                    // count the occurrences of every digit value in one read
+                    size_t counts [DIGITS][RADIX];
+                    memset(counts, 0, sizeof(counts));
+                    for (size_t i = 0; i < length; ++i) {
+                        Bits bits = KeyTraits<Key>::to_bits(key(elements[i]));
+                        for (size_t digit = 0; digit < DIGITS; ++digit) {
+                            ++counts[digit][bits & (RADIX - 1)];
+                            bits = (Bits)(bits >> DIGIT_BITS);
+                        }
+                    }
+
+                    T *source = elements;
+                    T *destination = buffer;
+                    for (size_t digit = 0; digit < DIGITS; ++digit) {
+                        size_t *const count = counts[digit];
+
+                        // skip the digit if all keys share the same value of it
+                        const Bits firstValue = (Bits)(KeyTraits<Key>::to_bits(key(source[0])) >> (digit * DIGIT_BITS)) & (RADIX - 1);
+                        if (count[firstValue] == length) {
+                            continue;
+                        }
+
+                        // turn the counts into the offsets of the buckets
+                        size_t offset = 0;
+                        for (size_t value = 0; value < RADIX; ++value) {
+                            const size_t bucketSize = count[value];
+                            count[value] = offset;
+                            offset += bucketSize;
+                        }
+
+                        // scatter the elements to their buckets
+                        for (size_t i = 0; i < length; ++i) {
+                            const size_t value = (size_t)(KeyTraits<Key>::to_bits(key(source[i])) >> (digit * DIGIT_BITS)) & (RADIX - 1);
+                            destination[count[value]] = utility::move(source[i]);
+                            ++count[value];
+                        }
+
+                        T *const temp = source;
+                        source = destination;
+                        destination = temp;
+                    }
+
+                    // move the sorted elements from buffer[] back to elements[]
+                    if (source != elements) {
+                        utility::move_forward(source, elements, length);
+                    }
+                }
+            }
+            /**
+             * The elements are ordered by the keys extracted from them,
+             * and elements with equal keys keep their relative order (stable).
+             * @brief Sorts an array with radix sort using a scratch buffer provided by the caller.
+             * @param T The type of elements to be sorted.
+             * @param KeyExtractor The type of the key extractor.  Its keys must be integers or floating point numbers.
+             * @param elements The array of elements to be sorted.  This same array will be sorted after this function returns.
+             * @param start The index of the first element to be sorted.
+             * @param end The index of the first element not to be sorted after <code>start</code>.
+             * @param key The key extractor, called as <code>key(element)</code>.
+             * @param buffer The scratch space of at least <code>end - start</code> elements.  Its contents are unspecified after this function returns.
+             */
+            template<typename T, typename KeyExtractor>
+            inline void radix_sort(T *const elements, const size_t start, const size_t end, KeyExtractor key, T *const buffer) {
+                if (start + 1 >= end) {
+                    return;
+                }
+
+                _radix_sort::lsd_radix_sort(elements + start, buffer, end - start, key);
+            }
+
+            /**
+             * The elements are ordered by the keys extracted from them,
+             * and elements with equal keys keep their relative order (stable).
+             * A scratch buffer of <code>end - start</code> elements is allocated once.
+             * @brief Sorts an array with radix sort.
+             * @param T The type of elements to be sorted.
+             * @param KeyExtractor The type of the key extractor.  Its keys must be integers or floating point numbers.
+             * @param elements The array of elements to be sorted.  This same array will be sorted after this function returns.
+             * @param start The index of the first element to be sorted.
+             * @param end The index of the first element not to be sorted after <code>start</code>.
+             * @param key The key extractor, called as <code>key(element)</code>.
+             */
+            template<typename T, typename KeyExtractor>
+            inline void radix_sort(T *const elements, const size_t start, const size_t end, KeyExtractor key) {
+                if (start + 1 >= end) {
+                    return;
+                }
+
+                T *const buffer = new T[end - start];
+                _radix_sort::lsd_radix_sort(elements + start, buffer, end - start, key);
+                delete[] buffer;
+            }
+
+            /**
+             * @brief Sorts an array of integers or floating point numbers with radix sort using a scratch buffer provided by the caller.
+             * @param T The type of elements to be sorted.  It must be an integer or floating point type.
+             * @param elements The array of elements to be sorted.  This same array will be sorted after this function returns.
+             * @param start The index of the first element to be sorted.
+             * @param end The index of the first element not to be sorted after <code>start</code>.
+             * @param buffer The scratch space of at least <code>end - start</code> elements.  Its contents are unspecified after this function returns.
+             */
+            template<typename T>
+            inline void radix_sort(T *const elements, const size_t start, const size_t end, T *const buffer) {
+                radix_sort(elements, start, end, _radix_sort::IdentityKey(), buffer);
+            }
+
+            /**
+             * A scratch buffer of <code>end - start</code> elements is allocated once.
+             * @brief Sorts an array of integers or floating point numbers with radix sort.
+             * @param T The type of elements to be sorted.  It must be an integer or floating point type.
+             * @param elements The array of elements to be sorted.  This same array will be sorted after this function returns.
+             * @param start The index of the first element to be sorted.
+             * @param end The index of the first element not to be sorted after <code>start</code>.
+             */
+            template<typename T>
+            inline void radix_sort(T *const elements, const size_t start, const size_t end) {
+                radix_sort(elements, start, end, _radix_sort::IdentityKey());
+            }
+        }
+    }
+}
+
+#endif // #ifndef YH_ALGO_SORT_RADIX_SORT_H
\ No newline at end of file
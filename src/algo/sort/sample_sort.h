@@ -0,0 +1,717 @@
+/**
+ * @file sample_sort.h The in-place parallel sample sort implementation in C++.
+ * 
+ * @copyright Copyright (c) 2025 YH Choi. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef YH_ALGO_SORT_SAMPLE_SORT_H
+#define YH_ALGO_SORT_SAMPLE_SORT_H
+
+#ifndef ARDUINO
+
+#include <cstddef>
+#include <cstdint>
+
+#include "../../utility/functional.h"
+#include "../../utility/move.h"
+#include "_thread_pool.h"
+#include "pdq_sort.h"
+
+namespace yh {
+    namespace algo {
+        namespace sort {
+            namespace _sample_sort {
+                /**
+                 * @brief The default minimum number of elements given to a thread.
+                 */
+                static const size_t DEFAULT_GRAIN_SIZE = 65536U;
+
+                /**
+                 * @brief Ranges not longer than this are sorted with pdq sort.
+                 */
+                static const size_t BASE_CASE_LENGTH = 16384U;
+
+                /**
+                 * @brief The maximum number of buckets of a partitioning step, including equality buckets.
+                 */
+                static const size_t MAX_BUCKETS = 256U;
+
+                /**
+                 * @brief The base-2 logarithm of <code>MAX_BUCKETS</code>.
+                 */
+                static const size_t MAX_LOG_BUCKETS = 8U;
+
+                /**
+                 * @brief The number of samples taken per bucket.
+                 */
+                static const size_t OVERSAMPLING = 16U;
+
+                /**
+                 * @brief The number of elements classified together, so that their searches in the tree overlap.
+                 */
+                static const size_t BATCH_LENGTH = 8U;
+
+                /**
+                 * @brief The number of bytes of elements in a block.
+                 */
+                static const size_t BLOCK_BYTES = 2048U;
+
+                /**
+                 * @brief The number of elements moved together between the buffers and the array.
+                 */
+                template<typename T>
+                struct Block {
+                    static const size_t LENGTH = (sizeof(T) < BLOCK_BYTES) ? BLOCK_BYTES / sizeof(T) : 1U;
+                };
+
+                /**
+                 * Its size depends only on <code>T</code>, never on the number of elements to be sorted.
+                 * @brief The scratch space of a thread: a partial block per bucket, the samples and the splitters.
+                 */
+                template<typename T>
+                struct Workspace {
+                    T *buffers;
+                    T *hand;
+                    T *swap;
+                    T *overflow;
+                    T *samples;
+                    T *tree;
+                    T *splitters;
+                    size_t fills [MAX_BUCKETS];
+                    size_t counts [MAX_BUCKETS];
+
+                    Workspace() :
+                        buffers(new T[MAX_BUCKETS * Block<T>::LENGTH]),
+                        hand(new T[Block<T>::LENGTH]),
+                        swap(new T[Block<T>::LENGTH]),
+                        overflow(new T[Block<T>::LENGTH]),
+                        samples(new T[MAX_BUCKETS * OVERSAMPLING]),
+                        tree(new T[MAX_BUCKETS]),
+                        splitters(new T[MAX_BUCKETS]) {}
+
+                    Workspace(const Workspace &) = delete;
+                    Workspace &operator=(const Workspace &) = delete;
+
+                    ~Workspace() {
+                        delete[] buffers;
+                        delete[] hand;
+                        delete[] swap;
+                        delete[] overflow;
+                        delete[] samples;
+                        delete[] tree;
+                        delete[] splitters;
+                    }
+
+                    void reset(const size_t bucketCount) {
+                        for (size_t i = 0; i < bucketCount; ++i) {
+                            fills[i] = 0;
+                            counts[i] = 0;
+                        }
+                    }
+                };
+
+                /**
+                 * The splitters are stored as an implicit binary search tree (<code>tree[1]</code> is the root
+                 * and <code>tree[2i]</code>, <code>tree[2i + 1]</code> are the children of <code>tree[i]</code>),
+                 * so an element descends it with 1 comparison per level and no branch.
+                 * With equality buckets, the elements equal to the upper splitter of their bucket get a bucket of their own,
+                 * which needs no further sorting.
+                 * @brief The classifier of elements into buckets for a partitioning step.
+                 */
+                template<typename T, typename Compare>
+                struct Classifier {
+                    const T *tree;
+                    const T *splitters;
+                    size_t logBuckets;
+                    size_t treeBuckets;
+                    bool hasEqualityBuckets;
+                    const Compare *compare;
+
+                    size_t bucketCount() const {
+                        return hasEqualityBuckets ? treeBuckets * 2 : treeBuckets;
+                    }
+
+                    bool isEqualityBucket(const size_t bucket) const {
+                        return hasEqualityBuckets && (bucket % 2 == 1);
+                    }
+
+                    /**
+                     * @brief Classifies up to <code>BATCH_LENGTH</code> elements with their tree searches interleaved.
+                     */
+                    inline void classify(const T *const elements, const size_t length, size_t *const buckets) const {
+                        // locals keep the compiler from reloading them after every store to buckets
+                        const T *const tree = this->tree;
+                        const Compare &compare = *this->compare;
+                        size_t local [BATCH_LENGTH];
+                        for (size_t i = 0; i < length; ++i) {
+                            local[i] = 1;
+                        }
+                        for (size_t level = 0; level < logBuckets; ++level) {
+                            for (size_t i = 0; i < length; ++i) {
+                                local[i] = local[i] * 2 + (size_t)compare(tree[local[i]], elements[i]);
+                            }
+                        }
+                        if (hasEqualityBuckets) {
+                            for (size_t i = 0; i < length; ++i) {
+                                const size_t bucket = local[i] - treeBuckets;
+                                buckets[i] = bucket * 2 + ((bucket + 1 < treeBuckets) ? (size_t)!compare(elements[i], splitters[bucket]) : 0U);
+                            }
+                        } else {
+                            for (size_t i = 0; i < length; ++i) {
+                                buckets[i] = local[i] - treeBuckets;
+                            }
+                        }
+                    }
+
+                    inline size_t classify(const T &element) const {
+                        size_t bucket;
+                        classify(&element, 1, &bucket);
+                        return bucket;
+                    }
+                };
+
+                /**
+                 * @brief The part of an array classified by a thread.
+                 */
+                struct Stripe {
+                    size_t begin;
+                    size_t end;
+
+                    /**
+                     * @brief The end of the full blocks written back to the front of the stripe.
+                     */
+                    size_t written;
+                };
+
+                /**
+                 * @brief Gets the base-2 logarithm of a number, rounded down.
+                 */
+                inline size_t floor_log2(size_t value) {
+                    size_t log = 0;
+                    while (value > 1) {
+                        value /= 2;
+                        ++log;
+                    }
+                    return log;
+                }
+
+                /**
+                 * @brief Stores sorted splitters as an implicit binary search tree.
+                 */
+                template<typename T>
+                void build_tree(T *const tree, const T *const splitters, const size_t node, const size_t low, const size_t high) {
+                    const size_t middle = low + (high - low) / 2;
+                    tree[node] = splitters[middle];
+                    if (low < middle) {
+                        build_tree(tree, splitters, node * 2, low, middle);
+                        build_tree(tree, splitters, node * 2 + 1, middle + 1, high);
+                    }
+                }
+
+                /**
+                 * Samples are taken at pseudo-random positions and sorted, and every <code>OVERSAMPLING</code>-th sample becomes a splitter.
+                 * Duplicated splitters are removed and enable equality buckets, so that many equal elements are not partitioned again.
+                 * @brief Chooses the splitters of a partitioning step.
+                 * @param elements The first element to be partitioned.
+                 * @param length The number of elements, greater than <code>BASE_CASE_LENGTH</code>.
+                 * @param workspace The workspace holding the samples, the splitters and the tree.
+                 * @param classifier Set to the classifier using the splitters.
+                 */
+                template<typename T, typename Compare>
+                void choose_splitters(const T *const elements, const size_t length, Workspace<T> &workspace, Classifier<T, Compare> &classifier) {
+                    const Compare &compare = *classifier.compare;
+                    size_t logBuckets = floor_log2(length / BASE_CASE_LENGTH) + 1;
+                    if (logBuckets > MAX_LOG_BUCKETS) {
+                        logBuckets = MAX_LOG_BUCKETS;
+                    }
+                    size_t bucketCount = (size_t)1 << logBuckets;
+
+                    const size_t sampleCount = bucketCount * OVERSAMPLING;
+                    uint64_t state = (uint64_t)length * 0x9E3779B97F4A7C15ULL + 1U;
+                    for (size_t i = 0; i < sampleCount; ++i) {
+                        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+                        workspace.samples[i] = elements[(size_t)((state >> 32) % length)];
+                    }
+                    pdq_sort(workspace.samples, 0, sampleCount, compare);
+
+                    // take every OVERSAMPLING-th sample, dropping duplicates
+                    size_t splitterCount = 0;
+                    bool hasDuplicates = false;
+                    for (size_t i = OVERSAMPLING; i < sampleCount; i += OVERSAMPLING) {
+                        const T &sample = workspace.samples[i - 1];
+                        if (splitterCount > 0 && !compare(workspace.splitters[splitterCount - 1], sample)) {
+                            hasDuplicates = true;
+                            continue;
+                        }
+                        workspace.splitters[splitterCount] = sample;
+                        ++splitterCount;
+                    }
+
+                    // equality buckets double the buckets, so the tree must have half as many
+                    logBuckets = floor_log2(splitterCount) + 1;
+                    if (hasDuplicates && logBuckets == MAX_LOG_BUCKETS) {
+                        --logBuckets;
+                        const size_t reducedCount = ((size_t)1 << logBuckets) - 1;
+                        for (size_t i = 0; i < reducedCount; ++i) {
+                            workspace.splitters[i] = workspace.splitters[i * splitterCount / reducedCount];
+                        }
+                        splitterCount = reducedCount;
+                    }
+                    bucketCount = (size_t)1 << logBuckets;
+
+                    // pad with the largest splitter, whose extra buckets stay empty
+                    for (size_t i = splitterCount; i + 1 < bucketCount; ++i) {
+                        workspace.splitters[i] = workspace.splitters[splitterCount - 1];
+                    }
+                    build_tree(workspace.tree, workspace.splitters, 1, 0, bucketCount - 1);
+
+                    classifier.tree = workspace.tree;
+                    classifier.splitters = workspace.splitters;
+                    classifier.logBuckets = logBuckets;
+                    classifier.treeBuckets = bucketCount;
+                    classifier.hasEqualityBuckets = hasDuplicates;
+                }
+
+                /**
+                 * Every element is moved into the buffer of its bucket, and every full buffer is moved back
+                 * to the front of the stripe as a block, which never overtakes the elements not yet read.
+                 * @brief Classifies the elements of a stripe into blocks of the same bucket.
+                 * @param elements The first element of the array.
+                 * @param stripe The stripe to be classified, whose beginning is a multiple of the block length.
+                 * @param workspace The workspace of the thread, which keeps the partial blocks and the counts of buckets.
+                 * @param classifier The classifier of elements.
+                 */
+                template<typename T, typename Compare>
+                void classify_stripe(T *const elements, Stripe &stripe, Workspace<T> &workspace, const Classifier<T, Compare> &classifier) {
+                    const size_t BLOCK = Block<T>::LENGTH;
+                    workspace.reset(classifier.bucketCount());
+                    T *const buffers = workspace.buffers;
+                    size_t *const fills = workspace.fills;
+                    size_t *const counts = workspace.counts;
+                    size_t written = stripe.begin;
+                    size_t buckets [BATCH_LENGTH];
+                    for (size_t i = stripe.begin; i < stripe.end; i += BATCH_LENGTH) {
+                        const size_t batchLength = (stripe.end - i < BATCH_LENGTH) ? stripe.end - i : BATCH_LENGTH;
+                        classifier.classify(elements + i, batchLength, buckets);
+                        for (size_t j = 0; j < batchLength; ++j) {
+                            const size_t bucket = buckets[j];
+                            T *const buffer = buffers + bucket * BLOCK;
+                            const size_t fill = fills[bucket];
+                            buffer[fill] = utility::move(elements[i + j]);
+                            ++counts[bucket];
+                            if (fill + 1 == BLOCK) {
+                                utility::move_forward(buffer, elements + written, BLOCK);
+                                written += BLOCK;
+                                fills[bucket] = 0;
+                            } else {
+                                fills[bucket] = fill + 1;
+                            }
+                        }
+                    }
+                    stripe.written = written;
+                }
+
+                /**
+                 * @brief Classifies a stripe on a thread of the pool.
+                 */
+                template<typename T, typename Compare>
+                struct ClassifyTask {
+                    T *elements;
+                    Stripe *stripe;
+                    Workspace<T> *workspace;
+                    const Classifier<T, Compare> *classifier;
+
+                    void operator()() {
+                        classify_stripe(elements, *stripe, *workspace, *classifier);
+                    }
+                };
+
+                /**
+                 * @brief Gets whether a block was written back by the classification.
+                 */
+                inline bool is_block_full(const Stripe *const stripes, const size_t stripeCount, const size_t begin) {
+                    for (size_t i = 0; i < stripeCount; ++i) {
+                        if (begin < stripes[i].end) {
+                            return begin >= stripes[i].begin && begin < stripes[i].written;
+                        }
+                    }
+                    return false;
+                }
+
+                /**
+                 * @brief Writes elements into the holes of a bucket: its head, then its tail.
+                 */
+                template<typename T>
+                struct HoleWriter {
+                    T *elements;
+                    size_t position;
+                    size_t end;
+                    size_t nextPosition;
+                    size_t nextEnd;
+
+                    void write(T *const source, const size_t count) {
+                        for (size_t i = 0; i < count; ++i) {
+                            if (position == end) {
+                                position = nextPosition;
+                                end = nextEnd;
+                            }
+                            elements[position] = utility::move(source[i]);
+                            ++position;
+                        }
+                    }
+                };
+
+                /**
+                 * The full blocks left by the classification of the stripes are permuted in place, block by block,
+                 * into the regions of their buckets, whose boundaries are rounded up to blocks.
+                 * Then the partial blocks in the buffers, and the parts of blocks spilling over the ends of their buckets,
+                 * are moved into the gaps at the heads and tails of their buckets.
+                 * @brief Moves classified elements into their buckets.
+                 * @param elements The first element of the array.
+                 * @param length The number of elements.
+                 * @param stripes The classified stripes, in order.
+                 * @param workspaces The workspaces which classified the stripes.
+                 * @param stripeCount The number of stripes.
+                 * @param classifier The classifier of elements.
+                 * @param bucketStarts Set to the indices of the first elements of all buckets, followed by <code>length</code>.
+                 */
+                template<typename T, typename Compare>
+                void distribute(T *const elements, const size_t length, const Stripe *const stripes, Workspace<T> *const workspaces,
+                    const size_t stripeCount, const Classifier<T, Compare> &classifier, size_t *const bucketStarts) {
+                    const size_t BLOCK = Block<T>::LENGTH;
+                    const size_t bucketCount = classifier.bucketCount();
+
+                    // the buckets and their regions of whole blocks
+                    bucketStarts[0] = 0;
+                    for (size_t bucket = 0; bucket < bucketCount; ++bucket) {
+                        size_t count = 0;
+                        for (size_t i = 0; i < stripeCount; ++i) {
+                            count += workspaces[i].counts[bucket];
+                        }
+                        bucketStarts[bucket + 1] = bucketStarts[bucket] + count;
+                    }
+                    size_t writeBlocks [MAX_BUCKETS];
+                    size_t readBlocks [MAX_BUCKETS];
+                    for (size_t bucket = 0; bucket < bucketCount; ++bucket) {
+                        const size_t regionBegin = (bucketStarts[bucket] + BLOCK - 1) / BLOCK;
+                        size_t regionEnd = (bucketStarts[bucket + 1] + BLOCK - 1) / BLOCK;
+
+                        // gather the full blocks at the front of the region
+                        size_t low = regionBegin;
+                        while (true) {
+                            while (low < regionEnd && is_block_full(stripes, stripeCount, low * BLOCK)) {
+                                ++low;
+                            }
+                            while (low < regionEnd && !is_block_full(stripes, stripeCount, (regionEnd - 1) * BLOCK)) {
+                                --regionEnd;
+                            }
+                            if (low >= regionEnd) {
+                                break;
+                            }
+                            --regionEnd;
+                            utility::move_forward(elements + regionEnd * BLOCK, elements + low * BLOCK, BLOCK);
+                            ++low;
+                        }
+                        writeBlocks[bucket] = regionBegin;
+                        readBlocks[bucket] = low;
+                    }
+
+                    // permute the blocks: [ write : read ) of every region holds blocks not yet in place
+                    Workspace<T> &workspace = workspaces[0];
+                    size_t overflowBucket = bucketCount;
+                    for (size_t bucket = 0; bucket < bucketCount; ++bucket) {
+                        while (writeBlocks[bucket] < readBlocks[bucket]) {
+                            T *const hole = elements + writeBlocks[bucket] * BLOCK;
+                            size_t destination = classifier.classify(*hole);
+                            if (destination == bucket) {
+                                ++writeBlocks[bucket];
+                                continue;
+                            }
+
+                            // carry blocks along the cycle until one lands in an empty block or in the hole
+                            T *hand = workspace.hand;
+                            T *spare = workspace.swap;
+                            utility::move_forward(hole, hand, BLOCK);
+                            while (true) {
+                                if (destination == bucket) {
+                                    utility::move_forward(hand, hole, BLOCK);
+                                    ++writeBlocks[bucket];
+                                    break;
+                                }
+                                const size_t target = writeBlocks[destination];
+                                ++writeBlocks[destination];
+                                if (target < readBlocks[destination]) {
+                                    T *const block = elements + target * BLOCK;
+                                    utility::move_forward(block, spare, BLOCK);
+                                    utility::move_forward(hand, block, BLOCK);
+                                    T *const temp = hand;
+                                    hand = spare;
+                                    spare = temp;
+                                    destination = classifier.classify(*hand);
+                                    continue;
+                                }
+
+                                // an empty block, or the overflow if the block would pass the end of the array
+                                if ((target + 1) * BLOCK > length) {
+                                    utility::move_forward(hand, workspace.overflow, BLOCK);
+                                    overflowBucket = destination;
+                                } else {
+                                    utility::move_forward(hand, elements + target * BLOCK, BLOCK);
+                                }
+
+                                // the hole is filled with the last block not yet in place
+                                --readBlocks[bucket];
+                                if (writeBlocks[bucket] < readBlocks[bucket]) {
+                                    utility::move_forward(elements + readBlocks[bucket] * BLOCK, hole, BLOCK);
+                                }
+                                break;
+                            }
+                        }
+                    }
+
+                    // fill the gaps of every bucket with the partial blocks and the spilling elements
+                    for (size_t bucket = 0; bucket < bucketCount; ++bucket) {
+                        const size_t begin = bucketStarts[bucket];
+                        const size_t end = bucketStarts[bucket + 1];
+                        const size_t blocksBegin = (begin + BLOCK - 1) / BLOCK * BLOCK;
+                        size_t blocksEnd = writeBlocks[bucket] * BLOCK;
+                        if (bucket == overflowBucket) {
+                            blocksEnd -= BLOCK;
+                        }
+
+                        HoleWriter<T> writer;
+                        writer.elements = elements;
+                        writer.position = begin;
+                        writer.end = (blocksBegin < end) ? blocksBegin : end;
+                        writer.nextPosition = (blocksEnd > writer.end) ? blocksEnd : writer.end;
+                        writer.nextEnd = (end > writer.nextPosition) ? end : writer.nextPosition;
+                        const size_t spillBegin = (blocksBegin > end) ? blocksBegin : end;
+                        if (blocksEnd > spillBegin) {
+                            writer.write(elements + spillBegin, blocksEnd - spillBegin);
+                        }
+                        for (size_t i = 0; i < stripeCount; ++i) {
+                            writer.write(workspaces[i].buffers + bucket * BLOCK, workspaces[i].fills[bucket]);
+                        }
+                        if (bucket == overflowBucket) {
+                            writer.write(workspace.overflow, BLOCK);
+                        }
+                    }
+                }
+
+                /**
+                 * @brief Splits an array into stripes starting at multiples of the block length.
+                 */
+                template<typename T>
+                inline void make_stripes(Stripe *const stripes, const size_t stripeCount, const size_t length) {
+                    const size_t blockCount = (length + Block<T>::LENGTH - 1) / Block<T>::LENGTH;
+                    for (size_t i = 0; i < stripeCount; ++i) {
+                        const size_t begin = blockCount * i / stripeCount * Block<T>::LENGTH;
+                        const size_t end = blockCount * (i + 1) / stripeCount * Block<T>::LENGTH;
+                        stripes[i].begin = (begin < length) ? begin : length;
+                        stripes[i].end = (end < length) ? end : length;
+                    }
+                }
+
+                /**
+                 * Buckets are sorted recursively, except the equality buckets, whose elements are all equal.
+                 * Steps which put all elements into 1 bucket fall back to pdq sort.
+                 * @brief Sorts an array with sample sort on the calling thread.
+                 * @param elements The first element to be sorted.
+                 * @param length The number of elements to be sorted.
+                 * @param workspace The workspace of the calling thread.
+                 * @param compare The comparator of elements.
+                 */
+                template<typename T, typename Compare>
+                void sequential_sample_sort(T *const elements, const size_t length, Workspace<T> &workspace, const Compare &compare) {
+                    if (length <= BASE_CASE_LENGTH) {
+                        pdq_sort(elements, 0, length, compare);
+                        return;
+                    }
+
+                    Classifier<T, Compare> classifier;
+                    classifier.compare = &compare;
+                    choose_splitters(elements, length, workspace, classifier);
+
+                    Stripe stripe;
+                    make_stripes<T>(&stripe, 1, length);
+                    classify_stripe(elements, stripe, workspace, classifier);
+                    size_t bucketStarts [MAX_BUCKETS + 1];
+                    distribute(elements, length, &stripe, &workspace, 1, classifier, bucketStarts);
+
+                    const size_t bucketCount = classifier.bucketCount();
+                    for (size_t bucket = 0; bucket < bucketCount; ++bucket) {
+                        const size_t bucketLength = bucketStarts[bucket + 1] - bucketStarts[bucket];
+                        if (bucketLength == length) { // no progress
+                            if (!classifier.isEqualityBucket(bucket)) {
+                                pdq_sort(elements, 0, length, compare);
+                            }
+                            return;
+                        }
+                        if (bucketLength > 1 && !classifier.isEqualityBucket(bucket)) {
+                            sequential_sample_sort(elements + bucketStarts[bucket], bucketLength, workspace, compare);
+                        }
+                    }
+                }
+
+                /**
+                 * The workspace is allocated only for buckets long enough to be partitioned again.
+                 * @brief Sorts a bucket on a thread of the pool.
+                 */
+                template<typename T, typename Compare>
+                struct BucketTask {
+                    T *elements;
+                    size_t length;
+                    const Compare *compare;
+
+                    void operator()() {
+                        if (length <= BASE_CASE_LENGTH) {
+                            pdq_sort(elements, 0, length, *compare);
+                            return;
+                        }
+                        Workspace<T> workspace;
+                        sequential_sample_sort(elements, length, workspace, *compare);
+                    }
+                };
+
+                /**
+                 * The stripes are classified concurrently, the blocks are distributed on the calling thread,
+                 * and the buckets are sorted concurrently, longest first.
+                 * @brief Sorts an array with sample sort on multiple threads.
+                 * @param pool The thread pool running the tasks.
+                 * @param elements The first element to be sorted.
+                 * @param length The number of elements to be sorted, greater than <code>BASE_CASE_LENGTH</code>.
+                 * @param compare The comparator of elements, shared by all threads.
+                 */
+                template<typename T, typename Compare>
+                void parallel_sample_sort(_thread_pool::ThreadPool &pool, T *const elements, const size_t length, const Compare &compare) {
+                    const size_t threadCount = pool.size();
+                    Workspace<T> *const workspaces = new Workspace<T>[threadCount];
+                    Stripe *const stripes = new Stripe[threadCount];
+
+                    Classifier<T, Compare> classifier;
+                    classifier.compare = &compare;
+                    choose_splitters(elements, length, workspaces[0], classifier);
+
+                    make_stripes<T>(stripes, threadCount, length);
+                    ClassifyTask<T, Compare> *const classifyTasks = new ClassifyTask<T, Compare>[threadCount];
+                    for (size_t i = 0; i < threadCount; ++i) {
+                        classifyTasks[i].elements = elements;
+                        classifyTasks[i].stripe = stripes + i;
+                        classifyTasks[i].workspace = workspaces + i;
+                        classifyTasks[i].classifier = &classifier;
+                    }
+                    pool.run(classifyTasks, threadCount);
+                    delete[] classifyTasks;
+
+                    size_t bucketStarts [MAX_BUCKETS + 1];
+                    distribute(elements, length, stripes, workspaces, threadCount, classifier, bucketStarts);
+                    delete[] stripes;
+                    delete[] workspaces;
+
+                    // sort the buckets, longest first so that the threads finish together
+                    const size_t bucketCount = classifier.bucketCount();
+                    BucketTask<T, Compare> *const bucketTasks = new BucketTask<T, Compare>[bucketCount];
+                    size_t taskCount = 0;
+                    for (size_t bucket = 0; bucket < bucketCount; ++bucket) {
+                        const size_t bucketLength = bucketStarts[bucket + 1] - bucketStarts[bucket];
+                        if (bucketLength > 1 && !classifier.isEqualityBucket(bucket)) {
+                            BucketTask<T, Compare> &task = bucketTasks[taskCount];
+                            task.elements = elements + bucketStarts[bucket];
+                            task.length = bucketLength;
+                            task.compare = &compare;
+                            ++taskCount;
+                        }
+                    }
+                    for (size_t i = 1; i < taskCount; ++i) {
+                        const BucketTask<T, Compare> task = bucketTasks[i];
+                        size_t j = i;
+                        for (; j > 0 && bucketTasks[j - 1].length < task.length; --j) {
+                            bucketTasks[j] = bucketTasks[j - 1];
+                        }
+                        bucketTasks[j] = task;
+                    }
+                    if (taskCount == 1 && bucketTasks[0].length == length) { // no progress
+                        pdq_sort(elements, 0, length, compare);
+                    } else {
+                        pool.run(bucketTasks, taskCount);
+                    }
+                    delete[] bucketTasks;
+                }
+            }
+            /**
+             * This is an in-place super scalar sample sort (IPS4o):
+             * up to 256 buckets are delimited by splitters drawn from a sample and stored as a search tree,
+             * which classifies elements without branches.  The elements are moved into their buckets block by block in place,
+             * and the buckets are sorted recursively, with pdq sort for short ones.
+             * The extra memory is a buffer of 256 blocks of 2 KiB per thread, which does not grow with the number of elements.
+             * The classification of the first step and the sorting of the buckets run on multiple threads.
+             * Ranges shorter than 2 grains are sorted on the calling thread.
+             * This sort is not stable.
+             * @brief Sorts an array with sample sort on multiple threads.
+             * @param T The type of elements to be sorted.
+             * @param elements The array of elements to be sorted.  This same array will be sorted after this function returns.
+             * @param start The index of the first element to be sorted.
+             * @param end The index of the first element not to be sorted after <code>start</code>.
+             * @param maxThreads The maximum number of threads to be used, or 0 to use 1 thread per processor.
+             * @param grainSize The minimum number of elements given to a thread.
+             * @param compare The comparator returning whether its first argument goes before its second.  It is <code>operator&lt;</code> by default, and is called from multiple threads at once.
+             * @note Only available when <code>ARDUINO</code> is not defined.
+             */
+            template<typename T, typename Compare = utility::Less>
+            inline void sample_sort(T *const elements, const size_t start, const size_t end, const size_t maxThreads = 0, const size_t grainSize = _sample_sort::DEFAULT_GRAIN_SIZE, Compare compare = Compare()) {
+                if (start + 1 >= end) {
+                    return;
+                }
+
+                const size_t toSortLength = end - start;
+                if (toSortLength <= _sample_sort::BASE_CASE_LENGTH) {
+                    pdq_sort(elements, start, end, compare);
+                    return;
+                }
+
+                const size_t grainCount = toSortLength / ((grainSize > 0) ? grainSize : 1);
+                size_t threadCount = (maxThreads > 0) ? maxThreads : _thread_pool::hardware_concurrency();
+                if (threadCount > grainCount) {
+                    threadCount = grainCount;
+                }
+                if (threadCount <= 1) {
+                    _sample_sort::Workspace<T> workspace;
+                    _sample_sort::sequential_sample_sort(elements + start, toSortLength, workspace, compare);
+                    return;
+                }
+
+                _thread_pool::ThreadPool pool(threadCount);
+                _sample_sort::parallel_sample_sort(pool, elements + start, toSortLength, compare);
+            }
+        }
+    }
+}
+
+#endif // #ifndef ARDUINO
+
+#endif // #ifndef YH_ALGO_SORT_SAMPLE_SORT_H
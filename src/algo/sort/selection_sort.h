@@ -38,26 +38,22 @@
 #include <cstddef>
 #endif
 
+#include "../../utility/functional.h"
+#include "../../utility/move.h"
+
 namespace yh {
     namespace algo {
         namespace sort {
-            namespace _selection_sort {
-                template<typename T>
-                inline void swap(T &lhs, T &rhs) {
-                    T temp = lhs; // copy lhs to temp
-                    lhs = rhs; // move rhs to lhs
-                    rhs = temp; // move temp to rhs
-                }
-            }
             /**
              * @brief Sorts an array with selection sort.
              * @param T The type of elements to be sorted.
              * @param elements The array of elements to be sorted.  This same array will be sorted after this function returns.
              * @param start The index of the first element to be sorted.
              * @param end The index of the first element not to be sorted after <code>start</code>.
+             * @param compare The comparator returning whether its first argument goes before its second.  It is <code>operator&lt;</code> by default.
              */
-            template<typename T>
-            inline void selection_sort(T *const elements, const size_t start, const size_t end) {
+            template<typename T, typename Compare = utility::Less>
+            inline void selection_sort(T *const elements, const size_t start, const size_t end, Compare compare = Compare()) {
                 if (start + 1 >= end) {
                     return;
                 }
@@ -66,11 +62,13 @@ namespace yh {
                 for (T *insert_ptr = elements + start; insert_ptr < end_ptr; ++insert_ptr) {
                     T *min_ptr = insert_ptr;
                     for (T *running_ptr = insert_ptr + 1; running_ptr < end_ptr; ++running_ptr) {
-                        if ((*running_ptr) < (*min_ptr)) {
+                        if (compare(*running_ptr, *min_ptr)) {
                             min_ptr = running_ptr;
                         }
                     }
-                    _selection_sort::swap((*insert_ptr), (*min_ptr));
+                    if (min_ptr != insert_ptr) {
+                        utility::swap((*insert_ptr), (*min_ptr));
+                    }
                 }
             }
         }
@@ -1,5 +1,5 @@
 /**
- * @file sort.h The sort namespace documentation.
+ * @file sort.h The sort namespace documentation and the adaptive sort.
  * 
  * @copyright Copyright (c) 2025 YH Choi. All rights reserved.
  * 
@@ -32,6 +32,20 @@
 #ifndef YH_ALGO_SORT_H
 #define YH_ALGO_SORT_H
 
+#ifdef ARDUINO
+#include <stddef.h>
+#else
+#include <cstddef>
+#endif
+
+#include "../../utility/functional.h"
+#include "../../utility/type_traits.h"
+#include "merge_sort.h"
+#include "pdq_sort.h"
+#include "radix_sort.h"
+#include "sorting_network.h"
+#include "tim_sort.h"
+
 namespace yh {
     namespace algo {
         /**
@@ -39,8 +53,184 @@ namespace yh {
          * @brief Interfaces and implementations of sorting algorithms.
          */
         namespace sort {
+            namespace _sort {
+                /**
+                 * @brief The number of evenly spaced adjacent pairs compared to detect presorted arrays.
+                 */
+                static const size_t SAMPLE_COUNT = 32U;
+
+                /**
+                 * Below this, the histogram passes of radix sort cost more than the comparisons of pdq sort.
+                 * @brief The least length sorted by radix sort for integral types.
+                 */
+                static const size_t INTEGRAL_RADIX_SORT_THRESHOLD = 128U;
+
+                /**
+                 * @brief The least length sorted by radix sort for floating point types.
+                 */
+                static const size_t FLOATING_POINT_RADIX_SORT_THRESHOLD = 1024U;
+
+                /**
+                 * @brief Whether arrays of <code>T</code> ordered by <code>Compare</code> may be sorted by radix sort.
+                 */
+                template<typename T, typename Compare>
+                struct IsRadixSortable {
+                    static const bool VALUE = _radix_sort::KeyTraits<T>::IS_SUPPORTED && utility::IsSame<Compare, utility::Less>::VALUE;
+                };
+
+                /**
+                 * @brief Sorts an array with radix sort if <code>USE_RADIX_SORT</code>, otherwise with merge sort or pdq sort.
+                 */
+                template<bool USE_RADIX_SORT>
+                struct LargeSort {
+                    template<bool IS_STABLE, typename T, typename Compare>
+                    static inline void sort(T *const elements, const size_t start, const size_t end, const Compare &compare) {
+                        if (IS_STABLE) {
+                            merge_sort(elements, start, end, compare);
+                        } else {
+                            pdq_sort(elements, start, end, compare);
+                        }
+                    }
+                };
+
+                template<>
+                struct LargeSort<true> {
+                    template<bool IS_STABLE, typename T, typename Compare>
+                    static inline void sort(T *const elements, const size_t start, const size_t end, const Compare &compare) {
+                        const size_t threshold = utility::IsIntegral<T>::VALUE ? INTEGRAL_RADIX_SORT_THRESHOLD : FLOATING_POINT_RADIX_SORT_THRESHOLD;
+                        if (end - start >= threshold) {
+                            radix_sort(elements, start, end);
+                        } else {
+                            LargeSort<false>::template sort<IS_STABLE>(elements, start, end, compare);
+                        }
+                    }
+                };
+
+                /**
+                 * Random arrays have an ascending pair at each sample with probability 1/2,
+                 * so all samples agreeing almost surely means long runs, which tim sort merges in about O(n).
+                 * @brief Gets whether an array looks sorted or reverse-sorted from a sample of its adjacent pairs.
+                 * @param elements The array of elements.
+                 * @param start The index of the first element.
+                 * @param end The index of the first element not to be sampled after <code>start</code>, greater than <code>start + SAMPLE_COUNT</code>.
+                 * @param compare The comparator of elements.
+                 */
+                template<typename T, typename Compare>
+                inline bool is_presorted(const T *const elements, const size_t start, const size_t end, const Compare &compare) {
+                    const size_t step = (end - start - 1) / SAMPLE_COUNT;
+                    size_t descents = 0;
+                    for (size_t i = start; i + 1 < end; i += step) {
+                        if (compare(elements[i + 1], elements[i])) {
+                            ++descents;
+                        }
+                    }
+                    const size_t samples = (end - start - 2) / step + 1;
+                    return descents == 0 || descents == samples;
+                }
+
+                /**
+                 * @brief Sorts an array with the kernel chosen from its type, length and presortedness.
+                 * @param IS_STABLE Whether equal elements must keep their relative order.
+                 */
+                template<bool IS_STABLE, typename T, typename Compare>
+                inline void adaptive_sort(T *const elements, const size_t start, const size_t end, const Compare &compare) {
+                    if (start + 1 >= end) {
+                        return;
+                    }
+
+                    if (end - start <= _sorting_network::MAX_LENGTH) {
+                        static const bool USE_NETWORK = IS_STABLE ?
+                            _merge_sort::IsNetworkStable<T, Compare>::VALUE :
+                            (utility::IsArithmetic<T>::VALUE && utility::IsSame<Compare, utility::Less>::VALUE);
+                        _sorting_network::SmallSort<USE_NETWORK>::sort(elements, start, end, compare);
+                        return;
+                    }
+
+                    if (is_presorted(elements, start, end, compare)) {
+                        tim_sort(elements, start, end, compare);
+                        return;
+                    }
+
+                    // radix sort puts -0.0 before +0.0, which are equal under Less, so only integers may be radix sorted stably
+                    static const bool USE_RADIX_SORT = IsRadixSortable<T, Compare>::VALUE && (!IS_STABLE || utility::IsIntegral<T>::VALUE);
+                    LargeSort<USE_RADIX_SORT>::template sort<IS_STABLE>(elements, start, end, compare);
+                }
+
+                /**
+                 * @brief Sorts an array whose length is known at compile time with its sorting network if <code>USE_NETWORK</code>.
+                 */
+                template<bool USE_NETWORK>
+                struct FixedLengthSort {
+                    template<size_t N, typename T, typename Compare>
+                    static inline void sort(T *const elements, const Compare &) {
+                        sort_n<N>(elements);
+                    }
+                };
+
+                template<>
+                struct FixedLengthSort<false> {
+                    template<size_t N, typename T, typename Compare>
+                    static inline void sort(T *const elements, const Compare &compare) {
+                        adaptive_sort<false>(elements, 0, N, compare);
+                    }
+                };
+            }
+            /**
+             * The algorithm is chosen from the type of elements, the comparator, the length and a sample of the order:
+             * up to 32 elements are sorted with a sorting network (arithmetic types, default order) or insertion sort,
+             * arrays which look sorted or reverse-sorted with tim sort,
+             * long arrays of integers and floating point numbers in the default order with radix sort,
+             * and the others with pdq sort.
+             * This sort is not stable.  Use <code>stable_sort</code> if equal elements must keep their relative order.
+             * @brief Sorts an array with the algorithm expected to be the fastest.
+             * @param T The type of elements to be sorted.
+             * @param elements The array of elements to be sorted.  This same array will be sorted after this function returns.
+             * @param start The index of the first element to be sorted.
+             * @param end The index of the first element not to be sorted after <code>start</code>.
+             * @param compare The comparator returning whether its first argument goes before its second.  It is <code>operator&lt;</code> by default.
+             */
+            template<typename T, typename Compare = utility::Less>
+            inline void sort(T *const elements, const size_t start, const size_t end, Compare compare = Compare()) {
+                _sort::adaptive_sort<false>(elements, start, end, compare);
+            }
+
+            /**
+             * The algorithm is chosen as in <code>sort</code> among the stable ones:
+             * up to 32 elements are sorted with a sorting network (integral types, default order) or insertion sort,
+             * arrays which look sorted or reverse-sorted with tim sort,
+             * long arrays of integers in the default order with radix sort,
+             * and the others with merge sort.
+             * Floating point numbers are not radix sorted, which would move every -0.0 before every +0.0 although equal elements must keep their relative order.
+             * @brief Sorts an array with the stable algorithm expected to be the fastest.
+             * @param T The type of elements to be sorted.
+             * @param elements The array of elements to be sorted.  This same array will be sorted after this function returns.
+             * @param start The index of the first element to be sorted.
+             * @param end The index of the first element not to be sorted after <code>start</code>.
+             * @param compare The comparator returning whether its first argument goes before its second.  It is <code>operator&lt;</code> by default.
+             */
+            template<typename T, typename Compare = utility::Less>
+            inline void stable_sort(T *const elements, const size_t start, const size_t end, Compare compare = Compare()) {
+                _sort::adaptive_sort<true>(elements, start, end, compare);
+            }
+
+            /**
+             * Arrays of up to 32 arithmetic elements in the default order are sorted with the sorting network of their length,
+             * chosen at compile time.  The other arrays are sorted as in <code>sort</code>.
+             * This sort is not stable.
+             * @brief Sorts a whole array whose length is known at compile time.
+             * @param T The type of elements to be sorted.
+             * @param N The number of elements to be sorted.
+             * @param elements The array of elements to be sorted.  This same array will be sorted after this function returns.
+             * @param compare The comparator returning whether its first argument goes before its second.  It is <code>operator&lt;</code> by default.
+             */
+            template<typename T, size_t N, typename Compare = utility::Less>
+            inline void sort(T (&elements)[N], Compare compare = Compare()) {
+                static const bool USE_NETWORK = N <= _sorting_network::MAX_LENGTH &&
+                    utility::IsArithmetic<T>::VALUE && utility::IsSame<Compare, utility::Less>::VALUE;
+                _sort::FixedLengthSort<USE_NETWORK>::template sort<N>(elements, compare);
+            }
         }
     }
 }
 
-#endif // #ifndef YH_ALGO_SORT_H
\ No newline at end of file
+#endif // #ifndef YH_ALGO_SORT_H
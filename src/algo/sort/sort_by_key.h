@@ -0,0 +1,378 @@
+/**
+ * @file sort_by_key.h The key/value parallel array sort implementations in C++.
+ * 
+ * @copyright Copyright (c) 2025 YH Choi. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef YH_ALGO_SORT_SORT_BY_KEY_H
+#define YH_ALGO_SORT_SORT_BY_KEY_H
+
+#ifdef ARDUINO
+#include <stddef.h>
+#else
+#include <cstddef>
+#endif
+
+#include "../../utility/functional.h"
+#include "../../utility/move.h"
+#include "merge_sort.h"
+#include "quick_sort.h"
+
+namespace yh {
+    namespace algo {
+        namespace sort {
+            namespace _sort_by_key {
+                /**
+                 * @brief Swaps 2 keys and their values.
+                 */
+                template<typename K, typename V>
+                inline void swap(K *const keys, V *const values, const size_t i, const size_t j) {
+                    utility::swap(keys[i], keys[j]);
+                    utility::swap(values[i], values[j]);
+                }
+
+                /**
+                 * Equal keys are never moved across each other, so this sort is stable.
+                 * @brief Sorts keys and their values with insertion sort.
+                 * @param keys The array of keys to be sorted.
+                 * @param values The array of values moved with their keys.
+                 * @param start The index of the first key to be sorted.
+                 * @param end The index of the first key not to be sorted after <code>start</code>.
+                 * @param compare The comparator of keys.
+                 */
+                template<typename K, typename V, typename Compare>
+                inline void insertion_sort(K *const keys, V *const values, const size_t start, const size_t end, const Compare &compare) {
+                    for (size_t i = start + 1; i < end; ++i) {
+                        if (!compare(keys[i], keys[i - 1])) {
+                            continue;
+                        }
+
+                        K key = utility::move(keys[i]);
+                        V value = utility::move(values[i]);
+                        size_t hole = i;
+                        do {
+                            keys[hole] = utility::move(keys[hole - 1]);
+                            values[hole] = utility::move(values[hole - 1]);
+                            --hole;
+                        } while (hole > start && compare(key, keys[hole - 1]));
+                        keys[hole] = utility::move(key);
+                        values[hole] = utility::move(value);
+                    }
+                }
+
+                /**
+                 * @brief Moves a key down a max-heap of keys, swapping the values along.
+                 * @param keys The first key of the heap.
+                 * @param values The first value of the heap.
+                 * @param top The index of the key to be moved down.
+                 * @param length The number of keys in the heap.
+                 * @param compare The comparator of keys.
+                 */
+                template<typename K, typename V, typename Compare>
+                inline void sift_down(K *const keys, V *const values, size_t top, const size_t length, const Compare &compare) {
+                    size_t child = top * 2 + 1;
+                    while (child < length) {
+                        if (child + 1 < length && compare(keys[child], keys[child + 1])) {
+                            ++child;
+                        }
+                        if (!compare(keys[top], keys[child])) {
+                            return;
+                        }
+                        swap(keys, values, top, child);
+                        top = child;
+                        child = top * 2 + 1;
+                    }
+                }
+
+                /**
+                 * @brief Sorts keys and their values with heap sort.
+                 * @param keys The first key to be sorted.
+                 * @param values The first value to be moved with its key.
+                 * @param length The number of keys to be sorted.
+                 * @param compare The comparator of keys.
+                 */
+                template<typename K, typename V, typename Compare>
+                void heap_sort(K *const keys, V *const values, const size_t length, const Compare &compare) {
+                    for (size_t i = length / 2; i > 0; --i) {
+                        sift_down(keys, values, i - 1, length, compare);
+                    }
+                    for (size_t i = length - 1; i > 0; --i) {
+                        swap(keys, values, 0, i);
+                        sift_down(keys, values, 0, i, compare);
+                    }
+                }
+
+                /**
+                 * This is the same scheme as <code>_quick_sort::partition</code>, with the pivot chosen by <code>_quick_sort::median_of_three</code>.
+                 * @brief Chooses a pivot key and partitions the keys and their values around it with Hoare's scheme.
+                 * @param keys The array of keys to be partitioned.
+                 * @param values The array of values moved with their keys.
+                 * @param start The index of the first key to be partitioned.
+                 * @param end The index of the first key not to be partitioned after <code>start</code>, at least <code>start + 3</code>.
+                 * @param compare The comparator of keys.
+                 * @return The final index of the pivot.
+                 */
+                template<typename K, typename V, typename Compare>
+                inline size_t partition(K *const keys, V *const values, const size_t start, const size_t end, const Compare &compare) {
+                    const size_t length = end - start;
+                    K *const first = keys + start;
+                    K *const middle = first + length / 2;
+                    K *const last = keys + end - 1;
+
+                    K *pivot;
+                    if (length > _quick_sort::NINTHER_THRESHOLD) {
+                        const size_t step = length / 8;
+                        pivot = _quick_sort::median_of_three(
+                            _quick_sort::median_of_three(first, first + step, first + step * 2, compare),
+                            _quick_sort::median_of_three(middle - step, middle, middle + step, compare),
+                            _quick_sort::median_of_three(last - step * 2, last - step, last, compare),
+                            compare
+                        );
+                    } else {
+                        pivot = _quick_sort::median_of_three(first, middle, last, compare);
+                    }
+                    if (pivot != first) {
+                        swap(keys, values, start, (size_t)(pivot - keys));
+                    }
+
+                    size_t i = start;
+                    size_t j = end;
+                    while (true) {
+                        do {
+                            ++i;
+                        } while (i < end && compare(keys[i], keys[start]));
+                        do {
+                            --j;
+                        } while (compare(keys[start], keys[j])); // stops at the pivot at the latest
+                        if (i >= j) {
+                            break;
+                        }
+                        swap(keys, values, i, j);
+                    }
+
+                    // put the pivot to the middle of the partition
+                    if (j != start) {
+                        swap(keys, values, start, j);
+                    }
+                    return j;
+                }
+
+                /**
+                 * @brief Sorts keys and their values with introsort.
+                 * @param keys The array of keys to be sorted.
+                 * @param values The array of values moved with their keys.
+                 * @param start The index of the first key to be sorted.
+                 * @param end The index of the first key not to be sorted after <code>start</code>.
+                 * @param depth The number of partitioning levels left before falling back to heap sort.
+                 * @param compare The comparator of keys.
+                 */
+                template<typename K, typename V, typename Compare>
+                void introsort(K *const keys, V *const values, size_t start, size_t end, size_t depth, const Compare &compare) {
+                    while (end - start > _quick_sort::INSERTION_SORT_THRESHOLD) {
+                        if (depth == 0) {
+                            heap_sort(keys + start, values + start, end - start, compare);
+                            return;
+                        }
+                        --depth;
+
+                        const size_t pivot_position = partition(keys, values, start, end, compare);
+                        if (pivot_position - start < end - pivot_position) {
+                            introsort(keys, values, start, pivot_position, depth, compare);
+                            start = pivot_position + 1;
+                        } else {
+                            introsort(keys, values, pivot_position + 1, end, depth, compare);
+                            end = pivot_position;
+                        }
+                    }
+                    insertion_sort(keys, values, start, end, compare);
+                }
+
+                /**
+                 * Equal keys are taken from the left run first, so the merge is stable.
+                 * @brief Merges 2 adjacent sorted runs of keys and their values into other arrays.
+                 * @param keys The array of keys holding both runs.
+                 * @param values The array of values holding both runs.
+                 * @param lhs The index of the first key of the left run.
+                 * @param rhs The index of the first key of the right run, which is the end of the left run.
+                 * @param rhs_end The index of the first key not in the right run.
+                 * @param sorted_keys The destination of keys, which does not overlap with <code>keys</code>.
+                 * @param sorted_values The destination of values, which does not overlap with <code>values</code>.
+                 * @param compare The comparator of keys.
+                 */
+                template<typename K, typename V, typename Compare>
+                inline void merge(K *const keys, V *const values, size_t lhs, const size_t rhs, const size_t rhs_end,
+                    K *const sorted_keys, V *const sorted_values, const Compare &compare) {
+                    const size_t lhs_end = rhs;
+                    size_t rhs_index = rhs;
+                    size_t sorted = lhs;
+                    if (lhs < lhs_end && rhs_index < rhs_end && compare(keys[rhs_index], keys[lhs_end - 1])) {
+                        while (lhs < lhs_end && rhs_index < rhs_end) {
+                            const size_t from = compare(keys[rhs_index], keys[lhs]) ? rhs_index++ : lhs++;
+                            sorted_keys[sorted] = utility::move(keys[from]);
+                            sorted_values[sorted] = utility::move(values[from]);
+                            ++sorted;
+                        }
+                    }
+
+                    // move the remaining keys and values from lhs and then rhs
+                    utility::move_forward(keys + lhs, sorted_keys + sorted, lhs_end - lhs);
+                    utility::move_forward(values + lhs, sorted_values + sorted, lhs_end - lhs);
+                    sorted += lhs_end - lhs;
+                    utility::move_forward(keys + rhs_index, sorted_keys + sorted, rhs_end - rhs_index);
+                    utility::move_forward(values + rhs_index, sorted_values + sorted, rhs_end - rhs_index);
+                }
+
+                /**
+                 * The runs bounce between the arrays and the buffers on every pass,
+                 * and are moved back to the arrays at most once at the end.
+                 * @brief Sorts keys and their values with bottom-up merge sort.
+                 * @param keys The first key to be sorted.
+                 * @param values The first value to be moved with its key.
+                 * @param key_buffer The scratch space of at least <code>length</code> keys.
+                 * @param value_buffer The scratch space of at least <code>length</code> values.
+                 * @param length The number of keys to be sorted.
+                 * @param compare The comparator of keys.
+                 */
+                template<typename K, typename V, typename Compare>
+                void bottom_up_merge_sort(K *const keys, V *const values, K *const key_buffer, V *const value_buffer, const size_t length, const Compare &compare) {
+                    for (size_t run = 0; run < length; run += _merge_sort::INSERTION_SORT_RUN) {
+                        const size_t runEnd = (length - run > _merge_sort::INSERTION_SORT_RUN) ? run + _merge_sort::INSERTION_SORT_RUN : length;
+                        insertion_sort(keys, values, run, runEnd, compare);
+                    }
+
+                    K *source_keys = keys;
+                    V *source_values = values;
+                    K *destination_keys = key_buffer;
+                    V *destination_values = value_buffer;
+                    for (size_t width = _merge_sort::INSERTION_SORT_RUN; width < length; width *= 2) {
+                        for (size_t lhs = 0; lhs < length; lhs += width * 2) {
+                            const size_t rhs = (length - lhs > width) ? lhs + width : length;
+                            const size_t rhs_end = (length - rhs > width) ? rhs + width : length;
+                            merge(source_keys, source_values, lhs, rhs, rhs_end, destination_keys, destination_values, compare);
+                        }
+
+                        K *const temp_keys = source_keys;
+                        source_keys = destination_keys;
+                        destination_keys = temp_keys;
+                        V *const temp_values = source_values;
+                        source_values = destination_values;
+                        destination_values = temp_values;
+                    }
+
+                    // move the sorted keys and values from the buffers back
+                    if (source_keys != keys) {
+                        utility::move_forward(source_keys, keys, length);
+                        utility::move_forward(source_values, values, length);
+                    }
+                }
+            }
+            /**
+             * This is the introsort of <code>quick_sort</code> applied to 2 parallel arrays:
+             * only <code>keys</code> are compared, and <code>values[i]</code> is moved wherever <code>keys[i]</code> is moved,
+             * so the comparison loops stay within the dense key array.
+             * This sort is not stable.
+             * @brief Sorts an array of keys with quick sort, reordering an array of values in lockstep.
+             * @param K The type of keys to be sorted.
+             * @param V The type of values moved with their keys.
+             * @param keys The array of keys to be sorted.  This same array will be sorted after this function returns.
+             * @param values The array of values, where <code>values[i]</code> belongs to <code>keys[i]</code>.
+             * @param start The index of the first key to be sorted.
+             * @param end The index of the first key not to be sorted after <code>start</code>.
+             * @param compare The comparator of keys returning whether its first argument goes before its second.  It is <code>operator&lt;</code> by default.
+             */
+            template<typename K, typename V, typename Compare = utility::Less>
+            inline void quick_sort_by_key(K *const keys, V *const values, const size_t start, const size_t end, Compare compare = Compare()) {
+                if (start + 1 >= end) {
+                    return;
+                }
+
+                _sort_by_key::introsort(keys, values, start, end, _quick_sort::depth_limit(end - start), compare);
+            }
+
+            /**
+             * This is the bottom-up <code>merge_sort</code> applied to 2 parallel arrays:
+             * only <code>keys</code> are compared, and <code>values[i]</code> is moved wherever <code>keys[i]</code> is moved.
+             * This sort is stable.
+             * @brief Sorts an array of keys with merge sort, reordering an array of values in lockstep, using scratch buffers provided by the caller.
+             * @param K The type of keys to be sorted.
+             * @param V The type of values moved with their keys.
+             * @param keys The array of keys to be sorted.  This same array will be sorted after this function returns.
+             * @param values The array of values, where <code>values[i]</code> belongs to <code>keys[i]</code>.
+             * @param start The index of the first key to be sorted.
+             * @param end The index of the first key not to be sorted after <code>start</code>.
+             * @param keyBuffer The scratch space of at least <code>end - start</code> keys.  Its contents are unspecified after this function returns.
+             * @param valueBuffer The scratch space of at least <code>end - start</code> values.  Its contents are unspecified after this function returns.
+             * @param compare The comparator of keys returning whether its first argument goes before its second.  It is <code>operator&lt;</code> by default.
+             */
+            template<typename K, typename V, typename Compare = utility::Less>
+            inline void merge_sort_by_key(K *const keys, V *const values, const size_t start, const size_t end,
+                K *const keyBuffer, V *const valueBuffer, Compare compare = Compare()) {
+                if (start + 1 >= end) {
+                    return;
+                }
+
+                _sort_by_key::bottom_up_merge_sort(keys + start, values + start, keyBuffer, valueBuffer, end - start, compare);
+            }
+
+            /**
+             * This is the bottom-up <code>merge_sort</code> applied to 2 parallel arrays:
+             * only <code>keys</code> are compared, and <code>values[i]</code> is moved wherever <code>keys[i]</code> is moved.
+             * Scratch buffers of <code>end - start</code> keys and values are allocated once.
+             * This sort is stable.
+             * @brief Sorts an array of keys with merge sort, reordering an array of values in lockstep.
+             * @param K The type of keys to be sorted.
+             * @param V The type of values moved with their keys.
+             * @param keys The array of keys to be sorted.  This same array will be sorted after this function returns.
+             * @param values The array of values, where <code>values[i]</code> belongs to <code>keys[i]</code>.
+             * @param start The index of the first key to be sorted.
+             * @param end The index of the first key not to be sorted after <code>start</code>.
+             * @param compare The comparator of keys returning whether its first argument goes before its second.  It is <code>operator&lt;</code> by default.
+             */
+            template<typename K, typename V, typename Compare = utility::Less>
+            inline void merge_sort_by_key(K *const keys, V *const values, const size_t start, const size_t end, Compare compare = Compare()) {
+                if (start + 1 >= end) {
+                    return;
+                }
+
+                const size_t toSortLength = end - start;
+                if (toSortLength <= _merge_sort::INSERTION_SORT_RUN) {
+                    _sort_by_key::insertion_sort(keys, values, start, end, compare);
+                    return;
+                }
+
+                K *const keyBuffer = new K[toSortLength];
+                V *const valueBuffer = new V[toSortLength];
+                _sort_by_key::bottom_up_merge_sort(keys + start, values + start, keyBuffer, valueBuffer, toSortLength, compare);
+                delete[] keyBuffer;
+                delete[] valueBuffer;
+            }
+        }
+    }
+}
+
+#endif // #ifndef YH_ALGO_SORT_SORT_BY_KEY_H
@@ -0,0 +1,506 @@
+/**
+ * @file sorting_network.h The sorting network implementation in C++.
+ * 
+ * @copyright Copyright (c) 2025 YH Choi. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef YH_ALGO_SORT_SORTING_NETWORK_H
+#define YH_ALGO_SORT_SORTING_NETWORK_H
+
+#ifdef ARDUINO
+#include <stddef.h>
+#else
+#include <cstddef>
+#endif
+
+#include "../../utility/functional.h"
+#include "../../utility/move.h"
+#include "../../utility/type_traits.h"
+#include "insertion_sort.h"
+
+#if defined(__SSE4_1__)
+#include <smmintrin.h>
+#endif
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace yh {
+    namespace algo {
+        namespace sort {
+            namespace _sorting_network {
+                /**
+                 * @brief The longest array a sorting network is provided for.
+                 */
+                static const size_t MAX_LENGTH = 32U;
+
+                /**
+                 * Arithmetic types select the minimum and maximum without branching, which compiles to conditional moves.
+                 * Other types are swapped only when out of order.
+                 * @brief Orders 2 elements so that the first is not greater than the second.
+                 */
+                template<bool IS_BRANCHLESS>
+                struct CompareExchange {
+                    template<typename T>
+                    static inline void apply(T &a, T &b) {
+                        if (b < a) {
+                            utility::swap(a, b);
+                        }
+                    }
+                };
+
+                template<>
+                struct CompareExchange<true> {
+                    template<typename T>
+                    static inline void apply(T &a, T &b) {
+                        const bool isSwapped = b < a;
+                        const T low = isSwapped ? b : a;
+                        const T high = isSwapped ? a : b;
+                        a = low;
+                        b = high;
+                    }
+                };
+
+                template<typename T>
+                inline void compare_exchange(T &a, T &b) {
+                    CompareExchange<utility::IsArithmetic<T>::VALUE>::apply(a, b);
+                }
+
+                /**
+                 * @brief A comparator of a pruned network, which is dropped if <code>B</code> is beyond the array.
+                 */
+                template<size_t A, size_t B, size_t N, bool IS_ACTIVE = (B < N)>
+                struct Comparator {
+                    template<typename T>
+                    static inline void apply(T *const e) {
+                        compare_exchange(e[A], e[B]);
+                    }
+                };
+
+                template<size_t A, size_t B, size_t N>
+                struct Comparator<A, B, N, false> {
+                    template<typename T>
+                    static inline void apply(T *const) {}
+                };
+
+                /**
+                 * @brief The comparators <code>(i, i + R)</code> for <code>i = I, I + 2R, ...</code> while <code>i < END</code>.
+                 */
+                template<size_t I, size_t END, size_t R, size_t N, bool HAS_MORE = (I < END)>
+                struct MergeComparators {
+                    template<typename T>
+                    static inline void apply(T *const e) {
+                        Comparator<I, I + R, N>::apply(e);
+                        MergeComparators<I + R * 2, END, R, N>::apply(e);
+                    }
+                };
+
+                template<size_t I, size_t END, size_t R, size_t N>
+                struct MergeComparators<I, END, R, N, false> {
+                    template<typename T>
+                    static inline void apply(T *const) {}
+                };
+
+                /**
+                 * @brief Batcher's odd-even merge of the elements <code>LO, LO + R, ...</code> up to <code>HI</code> (inclusive).
+                 */
+                template<size_t LO, size_t HI, size_t R, size_t N, bool IS_RECURSIVE = (R * 2 < HI - LO)>
+                struct OddEvenMerge {
+                    template<typename T>
+                    static inline void apply(T *const e) {
+                        OddEvenMerge<LO, HI, R * 2, N>::apply(e); // even subsequence
+                        OddEvenMerge<LO + R, HI, R * 2, N>::apply(e); // odd subsequence
+                        MergeComparators<LO + R, HI - R, R, N>::apply(e);
+                    }
+                };
+
+                template<size_t LO, size_t HI, size_t R, size_t N>
+                struct OddEvenMerge<LO, HI, R, N, false> {
+                    template<typename T>
+                    static inline void apply(T *const e) {
+                        Comparator<LO, LO + R, N>::apply(e);
+                    }
+                };
+
+                /**
+                 * Comparators reaching beyond <code>N</code> are pruned, as if the array were padded with maximum elements.
+                 * @brief Batcher's odd-even merge sort network of <code>[ LO : HI ]</code>, whose length is a power of 2.
+                 */
+                template<size_t LO, size_t HI, size_t N, bool IS_NEEDED = (LO < HI && LO + 1 < N)>
+                struct OddEvenMergeSort {
+                    template<typename T>
+                    static inline void apply(T *const e) {
+                        OddEvenMergeSort<LO, LO + (HI - LO) / 2, N>::apply(e);
+                        OddEvenMergeSort<LO + (HI - LO) / 2 + 1, HI, N>::apply(e);
+                        OddEvenMerge<LO, HI, 1, N>::apply(e);
+                    }
+                };
+
+                template<size_t LO, size_t HI, size_t N>
+                struct OddEvenMergeSort<LO, HI, N, false> {
+                    template<typename T>
+                    static inline void apply(T *const) {}
+                };
+
+                /**
+                 * @brief Gets the least power of 2 not less than <code>n</code>.
+                 */
+                template<size_t N, size_t P = 1, bool IS_DONE = (P >= N)>
+                struct CeilPowerOf2 {
+                    static const size_t VALUE = CeilPowerOf2<N, P * 2>::VALUE;
+                };
+
+                template<size_t N, size_t P>
+                struct CeilPowerOf2<N, P, true> {
+                    static const size_t VALUE = P;
+                };
+
+                /**
+                 * Lengths up to 8 use networks with the fewest comparators known,
+                 * while longer lengths use Batcher's odd-even merge sort network.
+                 * @brief The sorting network of a fixed length.
+                 * @param N The number of elements.
+                 * @param T The type of elements.
+                 */
+                template<size_t N, typename T>
+                struct Network {
+                    static inline void sort(T *const e) {
+                        OddEvenMergeSort<0, CeilPowerOf2<N>::VALUE - 1, N>::apply(e);
+                    }
+                };
+
+                template<typename T>
+                struct Network<0, T> {
+                    static inline void sort(T *const) {}
+                };
+
+                template<typename T>
+                struct Network<1, T> {
+                    static inline void sort(T *const) {}
+                };
+
+                template<typename T>
+                struct Network<2, T> {
+                    static inline void sort(T *const e) {
+                        compare_exchange(e[0], e[1]);
+                    }
+                };
+
+                template<typename T>
+                struct Network<3, T> {
+                    static inline void sort(T *const e) {
+                        compare_exchange(e[0], e[2]);
+                        compare_exchange(e[0], e[1]);
+                        compare_exchange(e[1], e[2]);
+                    }
+                };
+
+                template<typename T>
+                struct Network<4, T> {
+                    static inline void sort(T *const e) {
+                        compare_exchange(e[0], e[1]);
+                        compare_exchange(e[2], e[3]);
+                        compare_exchange(e[0], e[2]);
+                        compare_exchange(e[1], e[3]);
+                        compare_exchange(e[1], e[2]);
+                    }
+                };
+
+                template<typename T>
+                struct Network<5, T> {
+                    static inline void sort(T *const e) {
+                        compare_exchange(e[0], e[1]);
+                        compare_exchange(e[3], e[4]);
+                        compare_exchange(e[2], e[4]);
+                        compare_exchange(e[2], e[3]);
+                        compare_exchange(e[0], e[3]);
+                        compare_exchange(e[0], e[2]);
+                        compare_exchange(e[1], e[4]);
+                        compare_exchange(e[1], e[3]);
+                        compare_exchange(e[1], e[2]);
+                    }
+                };
+
+                template<typename T>
+                struct Network<6, T> {
+                    static inline void sort(T *const e) {
+                        compare_exchange(e[1], e[2]);
+                        compare_exchange(e[4], e[5]);
+                        compare_exchange(e[0], e[2]);
+                        compare_exchange(e[3], e[5]);
+                        compare_exchange(e[0], e[1]);
+                        compare_exchange(e[3], e[4]);
+                        compare_exchange(e[1], e[4]);
+                        compare_exchange(e[0], e[3]);
+                        compare_exchange(e[2], e[5]);
+                        compare_exchange(e[1], e[3]);
+                        compare_exchange(e[2], e[4]);
+                        compare_exchange(e[2], e[3]);
+                    }
+                };
+
+                template<typename T>
+                struct Network<7, T> {
+                    static inline void sort(T *const e) {
+                        compare_exchange(e[1], e[2]);
+                        compare_exchange(e[3], e[4]);
+                        compare_exchange(e[5], e[6]);
+                        compare_exchange(e[0], e[2]);
+                        compare_exchange(e[3], e[5]);
+                        compare_exchange(e[4], e[6]);
+                        compare_exchange(e[0], e[1]);
+                        compare_exchange(e[4], e[5]);
+                        compare_exchange(e[2], e[6]);
+                        compare_exchange(e[0], e[4]);
+                        compare_exchange(e[1], e[5]);
+                        compare_exchange(e[0], e[3]);
+                        compare_exchange(e[2], e[5]);
+                        compare_exchange(e[1], e[3]);
+                        compare_exchange(e[2], e[4]);
+                        compare_exchange(e[2], e[3]);
+                    }
+                };
+
+                template<typename T>
+                struct Network<8, T> {
+                    static inline void sort(T *const e) {
+                        compare_exchange(e[0], e[2]);
+                        compare_exchange(e[1], e[3]);
+                        compare_exchange(e[4], e[6]);
+                        compare_exchange(e[5], e[7]);
+                        compare_exchange(e[0], e[4]);
+                        compare_exchange(e[1], e[5]);
+                        compare_exchange(e[2], e[6]);
+                        compare_exchange(e[3], e[7]);
+                        compare_exchange(e[0], e[1]);
+                        compare_exchange(e[2], e[3]);
+                        compare_exchange(e[4], e[5]);
+                        compare_exchange(e[6], e[7]);
+                        compare_exchange(e[2], e[4]);
+                        compare_exchange(e[3], e[5]);
+                        compare_exchange(e[1], e[4]);
+                        compare_exchange(e[3], e[6]);
+                        compare_exchange(e[1], e[2]);
+                        compare_exchange(e[3], e[4]);
+                        compare_exchange(e[5], e[6]);
+                    }
+                };
+
+#if defined(__SSE4_1__)
+                /**
+                 * @brief Sorts 4 lanes of a vector with the 5-comparator network (0,1)(2,3) (0,2)(1,3) (1,2).
+                 */
+                inline __m128 sort_lanes(__m128 v) {
+                    __m128 s = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1));
+                    v = _mm_blend_ps(_mm_min_ps(v, s), _mm_max_ps(v, s), 0xA);
+                    s = _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 0, 3, 2));
+                    v = _mm_blend_ps(_mm_min_ps(v, s), _mm_max_ps(v, s), 0xC);
+                    s = _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 1, 2, 0));
+                    v = _mm_blend_ps(_mm_min_ps(v, s), _mm_max_ps(v, s), 0x4);
+                    return v;
+                }
+
+                inline __m128i sort_lanes(__m128i v) {
+                    __m128i s = _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1));
+                    v = _mm_blend_epi16(_mm_min_epi32(v, s), _mm_max_epi32(v, s), 0xCC);
+                    s = _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2));
+                    v = _mm_blend_epi16(_mm_min_epi32(v, s), _mm_max_epi32(v, s), 0xF0);
+                    s = _mm_shuffle_epi32(v, _MM_SHUFFLE(3, 1, 2, 0));
+                    v = _mm_blend_epi16(_mm_min_epi32(v, s), _mm_max_epi32(v, s), 0x30);
+                    return v;
+                }
+
+                template<>
+                struct Network<4, float> {
+                    static inline void sort(float *const e) {
+                        _mm_storeu_ps(e, sort_lanes(_mm_loadu_ps(e)));
+                    }
+                };
+
+                template<>
+                struct Network<4, int> {
+                    static inline void sort(int *const e) {
+                        __m128i *const p = reinterpret_cast<__m128i *>(e);
+                        _mm_storeu_si128(p, sort_lanes(_mm_loadu_si128(p)));
+                    }
+                };
+#endif // #if defined(__SSE4_1__)
+
+#if defined(__AVX2__)
+                /**
+                 * @brief Applies a layer of disjoint comparators to 8 lanes of a vector.
+                 * @param MAX_LANES The bit mask of lanes which are the higher ends of their comparators.
+                 * @param partners The lane each lane is compared with, itself if none.
+                 */
+                template<int MAX_LANES>
+                inline __m256i compare_exchange_layer(const __m256i v, const __m256i partners) {
+                    const __m256i s = _mm256_permutevar8x32_epi32(v, partners);
+                    return _mm256_blend_epi32(_mm256_min_epi32(v, s), _mm256_max_epi32(v, s), MAX_LANES);
+                }
+
+                template<int MAX_LANES>
+                inline __m256 compare_exchange_layer(const __m256 v, const __m256i partners) {
+                    const __m256 s = _mm256_permutevar8x32_ps(v, partners);
+                    return _mm256_blend_ps(_mm256_min_ps(v, s), _mm256_max_ps(v, s), MAX_LANES);
+                }
+
+                /**
+                 * @brief Sorts 8 lanes of a vector with the 19-comparator network in 6 layers.
+                 */
+                template<typename V>
+                inline V sort_lanes_8(V v) {
+                    v = compare_exchange_layer<0xCC>(v, _mm256_setr_epi32(2, 3, 0, 1, 6, 7, 4, 5)); // (0,2)(1,3)(4,6)(5,7)
+                    v = compare_exchange_layer<0xF0>(v, _mm256_setr_epi32(4, 5, 6, 7, 0, 1, 2, 3)); // (0,4)(1,5)(2,6)(3,7)
+                    v = compare_exchange_layer<0xAA>(v, _mm256_setr_epi32(1, 0, 3, 2, 5, 4, 7, 6)); // (0,1)(2,3)(4,5)(6,7)
+                    v = compare_exchange_layer<0x30>(v, _mm256_setr_epi32(0, 1, 4, 5, 2, 3, 6, 7)); // (2,4)(3,5)
+                    v = compare_exchange_layer<0x50>(v, _mm256_setr_epi32(0, 4, 2, 6, 1, 5, 3, 7)); // (1,4)(3,6)
+                    v = compare_exchange_layer<0x54>(v, _mm256_setr_epi32(0, 2, 1, 4, 3, 6, 5, 7)); // (1,2)(3,4)(5,6)
+                    return v;
+                }
+
+                template<>
+                struct Network<8, float> {
+                    static inline void sort(float *const e) {
+                        _mm256_storeu_ps(e, sort_lanes_8(_mm256_loadu_ps(e)));
+                    }
+                };
+
+                template<>
+                struct Network<8, int> {
+                    static inline void sort(int *const e) {
+                        __m256i *const p = reinterpret_cast<__m256i *>(e);
+                        _mm256_storeu_si256(p, sort_lanes_8(_mm256_loadu_si256(p)));
+                    }
+                };
+#endif // #if defined(__AVX2__)
+
+                /**
+                 * @brief Sorts a short array with the sorting network of its length.
+                 * @param elements The first element to be sorted.
+                 * @param length The number of elements [ 0 : MAX_LENGTH ].
+                 */
+                template<typename T>
+                inline void sort_small(T *const elements, const size_t length) {
+                    switch (length) {
+                        case 2: Network<2, T>::sort(elements); break;
+                        case 3: Network<3, T>::sort(elements); break;
+                        case 4: Network<4, T>::sort(elements); break;
+                        case 5: Network<5, T>::sort(elements); break;
+                        case 6: Network<6, T>::sort(elements); break;
+                        case 7: Network<7, T>::sort(elements); break;
+                        case 8: Network<8, T>::sort(elements); break;
+                        case 9: Network<9, T>::sort(elements); break;
+                        case 10: Network<10, T>::sort(elements); break;
+                        case 11: Network<11, T>::sort(elements); break;
+                        case 12: Network<12, T>::sort(elements); break;
+                        case 13: Network<13, T>::sort(elements); break;
+                        case 14: Network<14, T>::sort(elements); break;
+                        case 15: Network<15, T>::sort(elements); break;
+                        case 16: Network<16, T>::sort(elements); break;
+                        case 17: Network<17, T>::sort(elements); break;
+                        case 18: Network<18, T>::sort(elements); break;
+                        case 19: Network<19, T>::sort(elements); break;
+                        case 20: Network<20, T>::sort(elements); break;
+                        case 21: Network<21, T>::sort(elements); break;
+                        case 22: Network<22, T>::sort(elements); break;
+                        case 23: Network<23, T>::sort(elements); break;
+                        case 24: Network<24, T>::sort(elements); break;
+                        case 25: Network<25, T>::sort(elements); break;
+                        case 26: Network<26, T>::sort(elements); break;
+                        case 27: Network<27, T>::sort(elements); break;
+                        case 28: Network<28, T>::sort(elements); break;
+                        case 29: Network<29, T>::sort(elements); break;
+                        case 30: Network<30, T>::sort(elements); break;
+                        case 31: Network<31, T>::sort(elements); break;
+                        case 32: Network<32, T>::sort(elements); break;
+                        default: break;
+                    }
+                }
+
+                /**
+                 * The networks order elements with <code>operator&lt;</code>, so <code>USE_NETWORK</code> implies the default comparator.
+                 * @brief Sorts a short range with its sorting network if <code>USE_NETWORK</code>, otherwise with insertion sort.
+                 */
+                template<bool USE_NETWORK>
+                struct SmallSort {
+                    template<typename T, typename Compare>
+                    static inline void sort(T *const elements, const size_t start, const size_t end, const Compare &) {
+                        sort_small(elements + start, end - start);
+                    }
+
+                    template<size_t N, typename T, typename Compare>
+                    static inline void sort_n(T *const elements, const Compare &) {
+                        // the length is known, so any length has a network, not only those up to MAX_LENGTH
+                        Network<N, T>::sort(elements);
+                    }
+                };
+
+                template<>
+                struct SmallSort<false> {
+                    template<typename T, typename Compare>
+                    static inline void sort(T *const elements, const size_t start, const size_t end, const Compare &compare) {
+                        insertion_sort(elements, start, end, compare);
+                    }
+
+                    template<size_t N, typename T, typename Compare>
+                    static inline void sort_n(T *const elements, const Compare &compare) {
+                        insertion_sort(elements, 0, N, compare);
+                    }
+                };
+            }
+            /**
+             * The elements are sorted by a fixed sequence of branchless compare-exchanges,
+             * with SSE4.1 and AVX2 versions for <code>int</code> and <code>float</code> when those instruction sets are enabled.
+             * This sort is not stable.
+             * @brief Sorts a fixed number of elements with a sorting network.
+             * @param N The number of elements to be sorted.
+             * @param T The type of elements to be sorted.
+             * @param elements The array of <code>N</code> elements to be sorted.  This same array will be sorted after this function returns.
+             */
+            template<size_t N, typename T>
+            inline void sort_n(T *const elements) {
+                _sorting_network::Network<N, T>::sort(elements);
+            }
+
+            /**
+             * The networks are branchless only with <code>operator&lt;</code>, so the other comparators sort with insertion sort.
+             * @brief Sorts a fixed number of elements with a comparator.
+             * @param N The number of elements to be sorted.
+             * @param T The type of elements to be sorted.
+             * @param elements The array of <code>N</code> elements to be sorted.  This same array will be sorted after this function returns.
+             * @param compare The comparator returning whether its first argument goes before its second.
+             */
+            template<size_t N, typename T, typename Compare>
+            inline void sort_n(T *const elements, Compare compare) {
+                _sorting_network::SmallSort<utility::IsSame<Compare, utility::Less>::VALUE>::template sort_n<N>(elements, compare);
+            }
+        }
+    }
+}
+
+#endif // #ifndef YH_ALGO_SORT_SORTING_NETWORK_H
\ No newline at end of file
@@ -0,0 +1,368 @@
+/**
+ * @file string_sort.h The string sort implementation in C++.
+ * 
+ * @copyright Copyright (c) 2025 YH Choi. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef YH_ALGO_SORT_STRING_SORT_H
+#define YH_ALGO_SORT_STRING_SORT_H
+
+#ifdef ARDUINO
+#include <stddef.h>
+#include <stdint.h>
+#else
+#include <cstddef>
+#include <cstdint>
+#endif
+
+#include "../../utility/move.h"
+
+namespace yh {
+    namespace algo {
+        namespace sort {
+            /**
+             * A string with an explicit length, which may contain NUL characters.
+             * @brief A pointer and length pair referring to characters owned elsewhere.
+             */
+            struct StringRef {
+                const char *data;
+                size_t length;
+            };
+
+            /**
+             * The default traits work with any type having <code>length()</code> and <code>operator[]</code>, e.g. <code>std::string</code> and Arduino's <code>String</code>.
+             * Specialize this for other string types.
+             * @brief Gets the characters of strings for <code>string_sort</code>.
+             * @param S The type of strings.
+             */
+            template<typename S>
+            struct StringTraits {
+                /**
+                 * @brief Gets a character of a string.
+                 * @param string The string.
+                 * @param index The index of the character, not greater than the length of the string.
+                 * @return The character as an <code>unsigned char</code>, or -1 at the end of the string.
+                 */
+                static inline int at(const S &string, const size_t index) {
+                    return (index < (size_t)string.length()) ? (int)(unsigned char)string[index] : -1;
+                }
+            };
+
+            template<>
+            struct StringTraits<const char *> {
+                static inline int at(const char *const string, const size_t index) {
+                    return (string[index] != '\0') ? (int)(unsigned char)string[index] : -1;
+                }
+            };
+
+            template<>
+            struct StringTraits<char *> : StringTraits<const char *> {};
+
+            template<>
+            struct StringTraits<StringRef> {
+                static inline int at(const StringRef &string, const size_t index) {
+                    return (index < string.length) ? (int)(unsigned char)string.data[index] : -1;
+                }
+            };
+
+            namespace _string_sort {
+                /**
+                 * @brief Ranges shorter than this are sorted with LCP insertion sort.
+                 */
+                static const size_t INSERTION_SORT_THRESHOLD = 16U;
+
+                /**
+                 * Below this, a multikey quicksort partition is cheaper than counting and moving every string through the buffer.
+                 * @brief Ranges not shorter than this are split by MSD radix sort instead of multikey quicksort.
+                 */
+                static const size_t RADIX_SORT_THRESHOLD = 4096U;
+
+                /**
+                 * @brief The number of buckets of a radix sort step: one for the end of string and one for every character.
+                 */
+                static const size_t RADIX = 257U;
+
+                /**
+                 * @brief Gets the length of the common prefix of 2 strings, knowing that they share the first <code>depth</code> characters.
+                 * @param depth The length of a known common prefix.
+                 * @param lhsChar Set to the character of <code>lhs</code> after the common prefix.
+                 * @param rhsChar Set to the character of <code>rhs</code> after the common prefix.
+                 */
+                template<typename S, typename Traits>
+                inline size_t common_prefix(const S &lhs, const S &rhs, size_t depth, int &lhsChar, int &rhsChar) {
+                    while (true) {
+                        lhsChar = Traits::at(lhs, depth);
+                        rhsChar = Traits::at(rhs, depth);
+                        if (lhsChar != rhsChar || lhsChar < 0) {
+                            return depth;
+                        }
+                        ++depth;
+                    }
+                }
+
+                /**
+                 * This reads every string once, instead of once per shared character.
+                 * @brief Gets the length of the prefix shared by all strings, knowing that they share the first <code>depth</code> characters.
+                 * @param elements The first string.
+                 * @param length The number of strings, at least 2.
+                 * @param depth The length of a known common prefix.
+                 */
+                template<typename S, typename Traits>
+                inline size_t common_prefix_of_all(const S *const elements, const size_t length, const size_t depth) {
+                    int firstChar;
+                    int otherChar;
+                    size_t sharedDepth = common_prefix<S, Traits>(elements[0], elements[1], depth, firstChar, otherChar);
+                    for (size_t i = 2; i < length && sharedDepth > depth; ++i) {
+                        const size_t lcp = common_prefix<S, Traits>(elements[0], elements[i], depth, firstChar, otherChar);
+                        if (lcp < sharedDepth) {
+                            sharedDepth = lcp;
+                        }
+                    }
+                    return sharedDepth;
+                }
+
+                /**
+                 * Each string remembers the length of its common prefix with its predecessor,
+                 * so the characters of a shared prefix are compared at most once per insertion instead of once per comparison.
+                 * Equal strings keep their relative order.
+                 * @brief Sorts strings sharing their first <code>depth</code> characters with insertion sort.
+                 * @param elements The first string to be sorted.
+                 * @param length The number of strings, less than <code>INSERTION_SORT_THRESHOLD</code>.
+                 * @param depth The length of the prefix shared by all strings.
+                 */
+                template<typename S, typename Traits>
+                void lcp_insertion_sort(S *const elements, const size_t length, const size_t depth) {
+                    size_t lcps [INSERTION_SORT_THRESHOLD]; // lcps[i] is the common prefix length of elements[i - 1] and elements[i]
+                    for (size_t j = 1; j < length; ++j) {
+                        S element = utility::move(elements[j]);
+
+                        // lcp is the common prefix length of element and the string after the hole
+                        size_t lcp = depth;
+                        size_t previousLcp = depth;
+                        size_t hole = j;
+                        while (hole > 0) {
+                            // the common prefix length of the string before the hole and the string after the hole
+                            const size_t neighbourLcp = (hole == j) ? lcp : lcps[hole];
+                            if (neighbourLcp < lcp) { // the string before the hole is less
+                                previousLcp = neighbourLcp;
+                                break;
+                            }
+                            if (neighbourLcp == lcp) {
+                                int previousChar;
+                                int elementChar;
+                                const size_t newLcp = common_prefix<S, Traits>(elements[hole - 1], element, lcp, previousChar, elementChar);
+                                if (previousChar <= elementChar) { // the string before the hole is not greater
+                                    previousLcp = newLcp;
+                                    break;
+                                }
+                                lcp = newLcp;
+                            }
+                            // otherwise the string before the hole shares more with the greater string after the hole, so it is greater
+
+                            elements[hole] = utility::move(elements[hole - 1]);
+                            if (hole < j) {
+                                lcps[hole + 1] = neighbourLcp;
+                            }
+                            --hole;
+                        }
+                        elements[hole] = utility::move(element);
+                        if (hole > 0) {
+                            lcps[hole] = previousLcp;
+                        }
+                        if (hole < j) {
+                            lcps[hole + 1] = lcp;
+                        }
+                    }
+                }
+
+                /**
+                 * @brief Gets the median of 3 values.
+                 */
+                inline int median_of_three(const int a, const int b, const int c) {
+                    if (a < b) {
+                        return (b < c) ? b : ((a < c) ? c : a);
+                    }
+                    return (a < c) ? a : ((b < c) ? c : b);
+                }
+
+                template<typename S, typename Traits>
+                void sort(S *elements, size_t length, size_t depth, S *const buffer, uint16_t *const characters);
+
+                /**
+                 * The strings are counted and moved through <code>buffer</code> into 257 buckets by their character at <code>depth</code>,
+                 * and every bucket except the one of ended strings is sorted from the next character.
+                 * Characters shared by all strings are skipped without moving the strings.
+                 * @brief Sorts strings sharing their first <code>depth</code> characters with a step of MSD radix sort.
+                 * @param elements The first string to be sorted.
+                 * @param length The number of strings.
+                 * @param depth The length of the prefix shared by all strings.
+                 * @param buffer The scratch space of at least <code>length</code> strings.
+                 * @param characters The scratch space of at least <code>length</code> characters.
+                 */
+                template<typename S, typename Traits>
+                void radix_sort(S *const elements, const size_t length, size_t depth, S *const buffer, uint16_t *const characters) {
+                    size_t bucketStarts [RADIX + 1];
+                    while (true) {
+                        for (size_t bucket = 0; bucket <= RADIX; ++bucket) {
+                            bucketStarts[bucket] = 0;
+                        }
+                        for (size_t i = 0; i < length; ++i) {
+                            characters[i] = (uint16_t)(Traits::at(elements[i], depth) + 1);
+                            ++bucketStarts[characters[i] + 1];
+                        }
+
+                        if (bucketStarts[characters[0] + 1] != length || characters[0] == 0) {
+                            break;
+                        }
+
+                        depth = common_prefix_of_all<S, Traits>(elements, length, depth + 1);
+                    }
+                    for (size_t bucket = 1; bucket <= RADIX; ++bucket) {
+                        bucketStarts[bucket] += bucketStarts[bucket - 1];
+                    }
+
+                    {
+                        size_t positions [RADIX];
+                        for (size_t bucket = 0; bucket < RADIX; ++bucket) {
+                            positions[bucket] = bucketStarts[bucket];
+                        }
+                        for (size_t i = 0; i < length; ++i) {
+                            buffer[positions[characters[i]]++] = utility::move(elements[i]);
+                        }
+                    }
+                    utility::move_forward(buffer, elements, length);
+
+                    // the strings in bucket 0 have ended, so they are all equal
+                    for (size_t bucket = 1; bucket < RADIX; ++bucket) {
+                        const size_t bucketLength = bucketStarts[bucket + 1] - bucketStarts[bucket];
+                        if (bucketLength > 1) {
+                            sort<S, Traits>(elements + bucketStarts[bucket], bucketLength, depth + 1, buffer, characters);
+                        }
+                    }
+                }
+
+                /**
+                 * Long ranges are split by MSD radix sort when <code>buffer</code> is given,
+                 * other ranges are split by a multikey quicksort partition into strings whose character at <code>depth</code> is
+                 * less than, equal to and greater than the pivot character, and short ranges are finished with LCP insertion sort.
+                 * Only the equal part proceeds to the next character, so shared prefixes are never compared again.
+                 * @brief Sorts strings sharing their first <code>depth</code> characters.
+                 * @param elements The first string to be sorted.
+                 * @param length The number of strings.
+                 * @param depth The length of the prefix shared by all strings.
+                 * @param buffer The scratch space of at least <code>length</code> strings, or nullptr to never use MSD radix sort.
+                 * @param characters The scratch space of at least <code>length</code> characters, or nullptr if <code>buffer</code> is nullptr.
+                 */
+                template<typename S, typename Traits>
+                void sort(S *elements, size_t length, size_t depth, S *const buffer, uint16_t *const characters) {
+                    while (length >= INSERTION_SORT_THRESHOLD) {
+                        if (buffer != nullptr && length >= RADIX_SORT_THRESHOLD) {
+                            radix_sort<S, Traits>(elements, length, depth, buffer, characters);
+                            return;
+                        }
+
+                        const int pivot = median_of_three(
+                            Traits::at(elements[0], depth),
+                            Traits::at(elements[length / 2], depth),
+                            Traits::at(elements[length - 1], depth)
+                        );
+
+                        // partition into [ 0 : less ) < pivot, [ less : greater ) == pivot and [ greater : length ) > pivot
+                        size_t less = 0;
+                        size_t i = 0;
+                        size_t greater = length;
+                        while (i < greater) {
+                            const int character = Traits::at(elements[i], depth);
+                            if (character < pivot) {
+                                if (i != less) {
+                                    utility::swap(elements[less], elements[i]);
+                                }
+                                ++less;
+                                ++i;
+                            } else if (character > pivot) {
+                                --greater;
+                                utility::swap(elements[i], elements[greater]);
+                            } else {
+                                ++i;
+                            }
+                        }
+
+                        if (pivot < 0) { // the equal strings have ended
+                            sort<S, Traits>(elements + greater, length - greater, depth, buffer, characters);
+                            return;
+                        }
+                        if (less == 0 && greater == length) { // all strings share this character, so skip their whole common prefix
+                            depth = common_prefix_of_all<S, Traits>(elements, length, depth + 1);
+                            continue;
+                        }
+                        sort<S, Traits>(elements, less, depth, buffer, characters);
+                        sort<S, Traits>(elements + greater, length - greater, depth, buffer, characters);
+                        elements += less;
+                        length = greater - less;
+                        ++depth;
+                    }
+                    lcp_insertion_sort<S, Traits>(elements, length, depth);
+                }
+            }
+            /**
+             * This is a multikey quicksort (Bentley and Sedgewick) with MSD radix sort for long ranges
+             * and LCP insertion sort for short ranges.  Each step looks at a single character of every string,
+             * so long shared prefixes, e.g. of URLs and paths, are not compared over and over as in comparison sorts.
+             * Strings are ordered lexicographically by their characters as <code>unsigned char</code>s, and a prefix goes before its extensions.
+             * Ranges of at least 4096 strings allocate a buffer of <code>end - start</code> strings for MSD radix sort.
+             * This sort is not stable.
+             * @brief Sorts an array of strings.
+             * @param S The type of strings, e.g. <code>const char *</code>, <code>StringRef</code> or <code>std::string</code>.
+             * @param Traits The traits getting the characters of strings.
+             * @param elements The array of strings to be sorted.  This same array will be sorted after this function returns.
+             * @param start The index of the first string to be sorted.
+             * @param end The index of the first string not to be sorted after <code>start</code>.
+             */
+            template<typename S, typename Traits = StringTraits<S> >
+            inline void string_sort(S *const elements, const size_t start, const size_t end) {
+                if (start + 1 >= end) {
+                    return;
+                }
+
+                const size_t toSortLength = end - start;
+                if (toSortLength < _string_sort::RADIX_SORT_THRESHOLD) {
+                    _string_sort::sort<S, Traits>(elements + start, toSortLength, 0, nullptr, nullptr);
+                    return;
+                }
+
+                S *const buffer = new S[toSortLength];
+                uint16_t *const characters = new uint16_t[toSortLength];
+                _string_sort::sort<S, Traits>(elements + start, toSortLength, 0, buffer, characters);
+                delete[] buffer;
+                delete[] characters;
+            }
+        }
+    }
+}
+
+#endif // #ifndef YH_ALGO_SORT_STRING_SORT_H
@@ -0,0 +1,697 @@
+/**
+ * @file tim_sort.h The tim sort implementation in C++.
+ * 
+ * @copyright Copyright (c) 2025 YH Choi. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef YH_ALGO_SORT_TIM_SORT_H
+#define YH_ALGO_SORT_TIM_SORT_H
+
+#ifdef ARDUINO
+#include <stddef.h>
+#else
+#include <cstddef>
+#endif
+
+#include "../../utility/functional.h"
+#include "../../utility/move.h"
+
+namespace yh {
+    namespace algo {
+        namespace sort {
+            namespace _tim_sort {
+                /**
+                 * @brief Arrays shorter than this are sorted with binary insertion sort without merging.
+                 */
+                static const size_t MIN_MERGE = 32U;
+
+                /**
+                 * @brief The initial number of consecutive wins of a run before entering galloping mode.
+                 */
+                static const size_t MIN_GALLOP = 7U;
+
+                /**
+                 * @brief The maximum number of pending runs, enough for any array addressable by size_t.
+                 */
+                static const size_t MAX_STACK = 85U;
+
+                /**
+                 * @brief Gets the minimum run length, such that the number of runs is a power of 2 or slightly less.
+                 * @param length The number of elements to be sorted.
+                 * @return The minimum run length in [ MIN_MERGE / 2 : MIN_MERGE ].
+                 */
+                inline size_t min_run_length(size_t length) {
+                    size_t remainder = 0;
+                    while (length >= MIN_MERGE) {
+                        remainder |= length & 1U;
+                        length >>= 1;
+                    }
+                    return length + remainder;
+                }
+
+                /**
+                 * @brief Reverses <code>elements[low : high)</code>.
+                 */
+                template<typename T>
+                inline void reverse(T *const elements, size_t low, size_t high) {
+                    while (low + 1 < high) {
+                        --high;
+                        utility::swap(elements[low], elements[high]);
+                        ++low;
+                    }
+                }
+
+                /**
+                 * A strictly descending run is reversed in place; equal elements never start a descending run, so the sort stays stable.
+                 * @brief Finds the length of the run beginning at <code>elements[low]</code> and makes it ascending.
+                 * @param elements The array of elements.
+                 * @param low The index of the first element of the run.
+                 * @param high The index after the last element which may be in the run.
+                 * @return The length of the run.
+                 */
+                template<typename T, typename Compare>
+                inline size_t count_run_and_make_ascending(T *const elements, const size_t low, const size_t high, const Compare &compare) {
+                    size_t runHigh = low + 1;
+                    if (runHigh == high) {
+                        return 1;
+                    }
+
+                    if (compare(elements[runHigh], elements[low])) {
+                        // strictly descending
+                        ++runHigh;
+                        while (runHigh < high && compare(elements[runHigh], elements[runHigh - 1])) {
+                            ++runHigh;
+                        }
+                        reverse(elements, low, runHigh);
+                    } else {
+                        // non-descending
+                        ++runHigh;
+                        while (runHigh < high && !compare(elements[runHigh], elements[runHigh - 1])) {
+                            ++runHigh;
+                        }
+                    }
+                    return runHigh - low;
+                }
+
+                /**
+                 * @brief Sorts <code>elements[low : high)</code> with binary insertion sort, given that <code>elements[low : sortedEnd)</code> is sorted.
+                 */
+                template<typename T, typename Compare>
+                inline void binary_insertion_sort(T *const elements, const size_t low, const size_t high, size_t sortedEnd, const Compare &compare) {
+                    if (sortedEnd == low) {
+                        ++sortedEnd;
+                    }
+                    for (; sortedEnd < high; ++sortedEnd) {
+                        T pivot = utility::move(elements[sortedEnd]);
+
+                        // find the position after all elements not greater than the pivot
+                        size_t left = low;
+                        size_t right = sortedEnd;
+                        while (left < right) {
+                            const size_t mid = left + (right - left) / 2;
+                            if (compare(pivot, elements[mid])) {
+                                right = mid;
+                            } else {
+                                left = mid + 1;
+                            }
+                        }
+
+                        utility::move_backward(elements + left, elements + left + 1, sortedEnd - left);
+                        elements[left] = utility::move(pivot);
+                    }
+                }
+
+                /**
+                 * @brief Finds the position to insert a key before all equal elements, galloping from a hint.
+                 * @param key The key to be inserted.
+                 * @param elements The sorted elements.
+                 * @param length The number of elements, at least 1.
+                 * @param hint The index to start galloping from [ 0 : length ).
+                 * @return The index k such that <code>elements[k - 1] < key <= elements[k]</code>.
+                 */
+                template<typename T, typename Compare>
+                inline size_t gallop_left(const T &key, const T *const elements, const size_t length, const size_t hint, const Compare &compare) {
+                    ptrdiff_t lastOffset = 0;
+                    ptrdiff_t offset = 1;
+                    if (compare(elements[hint], key)) {
+                        // gallop right until elements[hint + lastOffset] < key <= elements[hint + offset]
+                        const ptrdiff_t maxOffset = (ptrdiff_t)(length - hint);
+                        while (offset < maxOffset && compare(elements[hint + offset], key)) {
+                            lastOffset = offset;
+                            offset = offset * 2 + 1;
+                        }
+                        if (offset > maxOffset) {
+                            offset = maxOffset;
+                        }
+                        lastOffset += (ptrdiff_t)hint;
+                        offset += (ptrdiff_t)hint;
+                    } else {
+                        // gallop left until elements[hint - offset] < key <= elements[hint - lastOffset]
+                        const ptrdiff_t maxOffset = (ptrdiff_t)hint + 1;
+                        while (offset < maxOffset && !compare(elements[(ptrdiff_t)hint - offset], key)) {
+                            lastOffset = offset;
+                            offset = offset * 2 + 1;
+                        }
+                        if (offset > maxOffset) {
+                            offset = maxOffset;
+                        }
+                        const ptrdiff_t temp = lastOffset;
+                        lastOffset = (ptrdiff_t)hint - offset;
+                        offset = (ptrdiff_t)hint - temp;
+                    }
+
+                    // binary search in elements[lastOffset + 1 : offset]
+                    ++lastOffset;
+                    while (lastOffset < offset) {
+                        const ptrdiff_t mid = lastOffset + (offset - lastOffset) / 2;
+                        if (compare(elements[mid], key)) {
+                            lastOffset = mid + 1;
+                        } else {
+                            offset = mid;
+                        }
+                    }
+                    return (size_t)offset;
+                }
+
+                /**
+                 * @brief Finds the position to insert a key after all equal elements, galloping from a hint.
+                 * @param key The key to be inserted.
+                 * @param elements The sorted elements.
+                 * @param length The number of elements, at least 1.
+                 * @param hint The index to start galloping from [ 0 : length ).
+                 * @return The index k such that <code>elements[k - 1] <= key < elements[k]</code>.
+                 */
+                template<typename T, typename Compare>
+                inline size_t gallop_right(const T &key, const T *const elements, const size_t length, const size_t hint, const Compare &compare) {
+                    ptrdiff_t lastOffset = 0;
+                    ptrdiff_t offset = 1;
+                    if (compare(key, elements[hint])) {
+                        // gallop left until elements[hint - offset] <= key < elements[hint - lastOffset]
+                        const ptrdiff_t maxOffset = (ptrdiff_t)hint + 1;
+                        while (offset < maxOffset && compare(key, elements[(ptrdiff_t)hint - offset])) {
+                            lastOffset = offset;
+                            offset = offset * 2 + 1;
+                        }
+                        if (offset > maxOffset) {
+                            offset = maxOffset;
+                        }
+                        const ptrdiff_t temp = lastOffset;
+                        lastOffset = (ptrdiff_t)hint - offset;
+                        offset = (ptrdiff_t)hint - temp;
+                    } else {
+                        // gallop right until elements[hint + lastOffset] <= key < elements[hint + offset]
+                        const ptrdiff_t maxOffset = (ptrdiff_t)(length - hint);
+                        while (offset < maxOffset && !compare(key, elements[hint + offset])) {
+                            lastOffset = offset;
+                            offset = offset * 2 + 1;
+                        }
+                        if (offset > maxOffset) {
+                            offset = maxOffset;
+                        }
+                        lastOffset += (ptrdiff_t)hint;
+                        offset += (ptrdiff_t)hint;
+                    }
+
+                    // binary search in elements[lastOffset + 1 : offset]
+                    ++lastOffset;
+                    while (lastOffset < offset) {
+                        const ptrdiff_t mid = lastOffset + (offset - lastOffset) / 2;
+                        if (compare(key, elements[mid])) {
+                            offset = mid;
+                        } else {
+                            lastOffset = mid + 1;
+                        }
+                    }
+                    return (size_t)offset;
+                }
+
+                /**
+                 * @brief The state of a tim sort: the pending runs and the merge buffer.
+                 */
+                template<typename T, typename Compare>
+                class TimSort {
+                    private:
+                        /**
+                         * @brief The array being sorted.
+                         */
+                        T *const elements;
+
+                        /**
+                         * @brief The comparator of elements.
+                         */
+                        const Compare compare;
+
+                        /**
+                         * @brief The number of elements being sorted.
+                         */
+                        const size_t length;
+
+                        /**
+                         * @brief The merge buffer, allocated on the first merge.
+                         */
+                        T *buffer;
+
+                        /**
+                         * @brief The number of consecutive wins of a run before entering galloping mode, adapted to the data.
+                         */
+                        size_t minGallop;
+
+                        /**
+                         * @brief The indices of the first elements of the pending runs.
+                         */
+                        size_t runBase [MAX_STACK];
+
+                        /**
+                         * @brief The lengths of the pending runs.
+                         */
+                        size_t runLength [MAX_STACK];
+
+                        /**
+                         * @brief The number of pending runs.
+                         */
+                        size_t stackSize;
+
+                        TimSort(const TimSort &) = delete;
+                        TimSort &operator=(const TimSort &) = delete;
+
+                        /**
+                         * @brief Gets the merge buffer, which holds at least half of the elements.
+                         */
+                        T *getBuffer() {
+                            if (buffer == nullptr) {
+                                buffer = new T[length / 2 + 1];
+                            }
+                            return buffer;
+                        }
+
+                        /**
+                         * @brief Merges 2 adjacent runs from left to right, where the left run is the shorter one.
+                         * @param base1 The index of the first element of the left run, which is greater than the first element of the right run.
+                         * @param length1 The length of the left run, at least 1.
+                         * @param base2 The index of the first element of the right run, which is <code>base1 + length1</code>.
+                         * @param length2 The length of the right run, at least 1.  Its last element is less than the last element of the left run.
+                         */
+                        void merge_low(const size_t base1, size_t length1, const size_t base2, size_t length2) {
+                            T *const a = elements;
+                            T *const temp = getBuffer();
+                            utility::move_forward(a + base1, temp, length1);
+
+                            size_t cursor1 = 0; // in temp
+                            size_t cursor2 = base2; // in a
+                            size_t destination = base1; // in a
+
+                            // the first element of the right run goes first
+                            a[destination++] = utility::move(a[cursor2++]);
+                            if (--length2 == 0) {
+                                utility::move_forward(temp + cursor1, a + destination, length1);
+                                return;
+                            }
+                            if (length1 == 1) {
+                                utility::move_forward(a + cursor2, a + destination, length2);
+                                a[destination + length2] = utility::move(temp[cursor1]);
+                                return;
+                            }
+
+                            size_t gallop = minGallop;
+                            while (true) {
+                                size_t count1 = 0; // consecutive wins of the left run
+                                size_t count2 = 0; // consecutive wins of the right run
+
+                                // 1 pair at a time until a run keeps winning
+                                bool done = false;
+                                do {
+                                    if (compare(a[cursor2], temp[cursor1])) {
+                                        a[destination++] = utility::move(a[cursor2++]);
+                                        ++count2;
+                                        count1 = 0;
+                                        if (--length2 == 0) {
+                                            done = true;
+                                            break;
+                                        }
+                                    } else {
+                                        a[destination++] = utility::move(temp[cursor1++]);
+                                        ++count1;
+                                        count2 = 0;
+                                        if (--length1 == 1) {
+                                            done = true;
+                                            break;
+                                        }
+                                    }
+                                } while ((count1 | count2) < gallop);
+                                if (done) {
+                                    break;
+                                }
+
+                                // gallop until neither run wins by much
+                                do {
+                                    count1 = gallop_right(a[cursor2], temp + cursor1, length1, 0, compare);
+                                    if (count1 != 0) {
+                                        utility::move_forward(temp + cursor1, a + destination, count1);
+                                        destination += count1;
+                                        cursor1 += count1;
+                                        length1 -= count1;
+                                        if (length1 <= 1) {
+                                            done = true;
+                                            break;
+                                        }
+                                    }
+                                    a[destination++] = utility::move(a[cursor2++]);
+                                    if (--length2 == 0) {
+                                        done = true;
+                                        break;
+                                    }
+
+                                    count2 = gallop_left(temp[cursor1], a + cursor2, length2, 0, compare);
+                                    if (count2 != 0) {
+                                        utility::move_forward(a + cursor2, a + destination, count2);
+                                        destination += count2;
+                                        cursor2 += count2;
+                                        length2 -= count2;
+                                        if (length2 == 0) {
+                                            done = true;
+                                            break;
+                                        }
+                                    }
+                                    a[destination++] = utility::move(temp[cursor1++]);
+                                    if (--length1 == 1) {
+                                        done = true;
+                                        break;
+                                    }
+                                    if (gallop > 0) {
+                                        --gallop;
+                                    }
+                                } while (count1 >= MIN_GALLOP || count2 >= MIN_GALLOP);
+                                if (done) {
+                                    break;
+                                }
+                                gallop += 2; // penalize leaving galloping mode
+                            }
+                            minGallop = (gallop < 1) ? 1 : gallop;
+
+                            if (length1 == 1) {
+                                utility::move_forward(a + cursor2, a + destination, length2);
+                                a[destination + length2] = utility::move(temp[cursor1]);
+                            } else {
+                                // length1 is 0 only if the elements are not totally ordered
+                                utility::move_forward(temp + cursor1, a + destination, length1);
+                            }
+                        }
+
+                        /**
+                         * @brief Merges 2 adjacent runs from right to left, where the right run is the shorter one.
+                         * @param base1 The index of the first element of the left run, which is greater than the first element of the right run.
+                         * @param length1 The length of the left run, at least 1.
+                         * @param base2 The index of the first element of the right run, which is <code>base1 + length1</code>.
+                         * @param length2 The length of the right run, at least 1.  Its last element is less than the last element of the left run.
+                         */
+                        void merge_high(const size_t base1, size_t length1, const size_t base2, size_t length2) {
+                            T *const a = elements;
+                            T *const temp = getBuffer();
+                            utility::move_forward(a + base2, temp, length2);
+
+                            // cursors are 1 past the next element to be taken, so they never go below 0
+                            size_t cursor1 = base1 + length1; // in a
+                            size_t cursor2 = length2; // in temp
+                            size_t destination = base2 + length2; // in a
+
+                            // the last element of the left run goes last
+                            a[--destination] = utility::move(a[--cursor1]);
+                            if (--length1 == 0) {
+                                utility::move_forward(temp, a + destination - length2, length2);
+                                return;
+                            }
+                            if (length2 == 1) {
+                                destination -= length1;
+                                cursor1 -= length1;
+                                utility::move_backward(a + cursor1, a + destination, length1);
+                                a[destination - 1] = utility::move(temp[cursor2 - 1]);
+                                return;
+                            }
+
+                            size_t gallop = minGallop;
+                            while (true) {
+                                size_t count1 = 0; // consecutive wins of the left run
+                                size_t count2 = 0; // consecutive wins of the right run
+
+                                // 1 pair at a time until a run keeps winning
+                                bool done = false;
+                                do {
+                                    if (compare(temp[cursor2 - 1], a[cursor1 - 1])) {
+                                        a[--destination] = utility::move(a[--cursor1]);
+                                        ++count1;
+                                        count2 = 0;
+                                        if (--length1 == 0) {
+                                            done = true;
+                                            break;
+                                        }
+                                    } else {
+                                        a[--destination] = utility::move(temp[--cursor2]);
+                                        ++count2;
+                                        count1 = 0;
+                                        if (--length2 == 1) {
+                                            done = true;
+                                            break;
+                                        }
+                                    }
+                                } while ((count1 | count2) < gallop);
+                                if (done) {
+                                    break;
+                                }
+
+                                // gallop until neither run wins by much
+                                do {
+                                    count1 = length1 - gallop_right(temp[cursor2 - 1], a + base1, length1, length1 - 1, compare);
+                                    if (count1 != 0) {
+                                        destination -= count1;
+                                        cursor1 -= count1;
+                                        length1 -= count1;
+                                        utility::move_backward(a + cursor1, a + destination, count1);
+                                        if (length1 == 0) {
+                                            done = true;
+                                            break;
+                                        }
+                                    }
+                                    a[--destination] = utility::move(temp[--cursor2]);
+                                    if (--length2 == 1) {
+                                        done = true;
+                                        break;
+                                    }
+
+                                    count2 = length2 - gallop_left(a[cursor1 - 1], temp, length2, length2 - 1, compare);
+                                    if (count2 != 0) {
+                                        destination -= count2;
+                                        cursor2 -= count2;
+                                        length2 -= count2;
+                                        utility::move_forward(temp + cursor2, a + destination, count2);
+                                        if (length2 <= 1) {
+                                            done = true;
+                                            break;
+                                        }
+                                    }
+                                    a[--destination] = utility::move(a[--cursor1]);
+                                    if (--length1 == 0) {
+                                        done = true;
+                                        break;
+                                    }
+                                    if (gallop > 0) {
+                                        --gallop;
+                                    }
+                                } while (count1 >= MIN_GALLOP || count2 >= MIN_GALLOP);
+                                if (done) {
+                                    break;
+                                }
+                                gallop += 2; // penalize leaving galloping mode
+                            }
+                            minGallop = (gallop < 1) ? 1 : gallop;
+
+                            if (length2 == 1) {
+                                destination -= length1;
+                                cursor1 -= length1;
+                                utility::move_backward(a + cursor1, a + destination, length1);
+                                a[destination - 1] = utility::move(temp[cursor2 - 1]);
+                            } else {
+                                // length2 is 0 only if the elements are not totally ordered
+                                utility::move_forward(temp, a + destination - length2, length2);
+                            }
+                        }
+
+                        /**
+                         * @brief Merges the pending runs at <code>index</code> and <code>index + 1</code>.
+                         */
+                        void merge_at(const size_t index) {
+                            size_t base1 = runBase[index];
+                            size_t length1 = runLength[index];
+                            const size_t base2 = runBase[index + 1];
+                            size_t length2 = runLength[index + 1];
+
+                            runLength[index] = length1 + length2;
+                            if (index + 3 == stackSize) {
+                                runBase[index + 1] = runBase[index + 2];
+                                runLength[index + 1] = runLength[index + 2];
+                            }
+                            --stackSize;
+
+                            // elements of the left run not greater than the first of the right run are in place already
+                            const size_t skipped = gallop_right(elements[base2], elements + base1, length1, 0, compare);
+                            base1 += skipped;
+                            length1 -= skipped;
+                            if (length1 == 0) {
+                                return;
+                            }
+
+                            // elements of the right run not less than the last of the left run are in place already
+                            length2 = gallop_left(elements[base1 + length1 - 1], elements + base2, length2, length2 - 1, compare);
+                            if (length2 == 0) {
+                                return;
+                            }
+
+                            if (length1 <= length2) {
+                                merge_low(base1, length1, base2, length2);
+                            } else {
+                                merge_high(base1, length1, base2, length2);
+                            }
+                        }
+
+                    public:
+                        /**
+                         * @brief Creates the state to sort an array.
+                         * @param elements The first element to be sorted.
+                         * @param length The number of elements to be sorted.
+                         * @param compare The comparator of elements.
+                         */
+                        TimSort(T *const elements, const size_t length, const Compare &compare) :
+                            elements(elements), compare(compare), length(length), buffer(nullptr), minGallop(MIN_GALLOP), stackSize(0)
+                        {
+                            //
+                        }
+
+                        /**
+                         * @brief Destroys the state and its merge buffer.
+                         */
+                        ~TimSort() {
+                            delete[] buffer;
+                        }
+
+                        /**
+                         * @brief Pushes a run onto the pending run stack.
+                         */
+                        void push_run(const size_t base, const size_t length) {
+                            runBase[stackSize] = base;
+                            runLength[stackSize] = length;
+                            ++stackSize;
+                        }
+
+                        /**
+                         * Every pending run is longer than the sum of the next 2 runs above it,
+                         * so the run lengths grow at least like the Fibonacci numbers and the merges stay balanced.
+                         * @brief Merges pending runs until the run length invariants hold.
+                         */
+                        void merge_collapse() {
+                            while (stackSize > 1) {
+                                size_t n = stackSize - 2;
+                                if (
+                                    (n > 0 && runLength[n - 1] <= runLength[n] + runLength[n + 1]) ||
+                                    (n > 1 && runLength[n - 2] <= runLength[n] + runLength[n - 1])
+                                ) {
+                                    if (runLength[n - 1] < runLength[n + 1]) {
+                                        --n;
+                                    }
+                                } else if (runLength[n] > runLength[n + 1]) {
+                                    break; // the invariants hold
+                                }
+                                merge_at(n);
+                            }
+                        }
+
+                        /**
+                         * @brief Merges all pending runs into 1 run.
+                         */
+                        void merge_force_collapse() {
+                            while (stackSize > 1) {
+                                size_t n = stackSize - 2;
+                                if (n > 0 && runLength[n - 1] < runLength[n + 1]) {
+                                    --n;
+                                }
+                                merge_at(n);
+                            }
+                        }
+                };
+            }
+            /**
+             * Tim sort is stable and adaptive: it finds ascending and strictly descending runs already in the array,
+             * extends short runs to a minimum length with binary insertion sort,
+             * and merges runs from a balanced run stack, galloping through runs that win many times in a row.
+             * Sorted, reverse-sorted and concatenations of sorted inputs take close to O(n) time.
+             * A merge buffer of up to half the elements is allocated only if a merge is needed.
+             * @brief Sorts an array with tim sort.
+             * @param T The type of elements to be sorted.
+             * @param elements The array of elements to be sorted.  This same array will be sorted after this function returns.
+             * @param start The index of the first element to be sorted.
+             * @param end The index of the first element not to be sorted after <code>start</code>.
+             * @param compare The comparator returning whether its first argument goes before its second.  It is <code>operator&lt;</code> by default.
+             */
+            template<typename T, typename Compare = utility::Less>
+            inline void tim_sort(T *const elements, const size_t start, const size_t end, Compare compare = Compare()) {
+                if (start + 1 >= end) {
+                    return;
+                }
+
+                T *const toSort = elements + start;
+                const size_t toSortLength = end - start;
+
+                if (toSortLength < _tim_sort::MIN_MERGE) {
+                    const size_t runLength = _tim_sort::count_run_and_make_ascending(toSort, 0, toSortLength, compare);
+                    _tim_sort::binary_insertion_sort(toSort, 0, toSortLength, runLength, compare);
+                    return;
+                }
+
+                _tim_sort::TimSort<T, Compare> timSort(toSort, toSortLength, compare);
+                const size_t minRun = _tim_sort::min_run_length(toSortLength);
+                size_t low = 0;
+                while (low < toSortLength) {
+                    const size_t remaining = toSortLength - low;
+                    size_t runLength = _tim_sort::count_run_and_make_ascending(toSort, low, toSortLength, compare);
+
+                    // extend a short run to the minimum run length
+                    if (runLength < minRun) {
+                        const size_t forcedLength = (remaining <= minRun) ? remaining : minRun;
+                        _tim_sort::binary_insertion_sort(toSort, low, low + forcedLength, low + runLength, compare);
+                        runLength = forcedLength;
+                    }
+
+                    timSort.push_run(low, runLength);
+                    timSort.merge_collapse();
+                    low += runLength;
+                }
+                timSort.merge_force_collapse();
+            }
+        }
+    }
+}
+
+#endif // #ifndef YH_ALGO_SORT_TIM_SORT_H
\ No newline at end of file
@@ -32,17 +32,69 @@
 #ifndef YH_STRUCTURES_LISTS_ARRAYLIST_H
 #define YH_STRUCTURES_LISTS_ARRAYLIST_H
 
+#ifdef ARDUINO
+#include <stdlib.h>
+#include <string.h>
+#else
+#include <cstdlib>
+#include <cstring>
+#endif
+
 #include "List.h"
 
 namespace yh {
     namespace structures {
         namespace lists {
+            /**
+             * The capacity doubles when the array is full, and halves only when less than a quarter of it is used,
+             * so a list whose size hovers around a power of 2 does not reallocate on every other operation.
+             * Another policy can be given to <code>ArrayList</code> as a struct with the same static members.
+             * The capacities returned by a policy should never be 0; <code>ArrayList</code> raises them to at least 1,
+             * and raises a grown capacity to at least the number of elements required.
+             * @brief The default growth and shrink policy of array lists.
+             */
+            struct CapacityPolicy {
+                /**
+                 * @brief The capacity the array never shrinks below.
+                 */
+                static const size_t MIN_CAPACITY = 16U;
+
+                /**
+                 * @brief Gets the capacity to grow to.
+                 * @param capacity The current capacity.
+                 * @param required The number of elements to be held, greater than <code>capacity</code>.
+                 * @return The new capacity, not less than <code>required</code>.
+                 */
+                static size_t grow(const size_t capacity, const size_t required) {
+                    size_t newCapacity = (capacity < MIN_CAPACITY) ? MIN_CAPACITY : capacity;
+                    while (newCapacity < required) {
+                        newCapacity *= 2;
+                    }
+                    return newCapacity;
+                }
+
+                /**
+                 * @brief Gets the capacity to shrink to after removing elements.
+                 * @param capacity The current capacity.
+                 * @param count The number of elements left.
+                 * @return The new capacity, or <code>capacity</code> to keep the array.
+                 */
+                static size_t shrink(const size_t capacity, const size_t count) {
+                    size_t newCapacity = capacity;
+                    while (newCapacity > MIN_CAPACITY && count * 4 < newCapacity) {
+                        newCapacity /= 2;
+                    }
+                    return (newCapacity < MIN_CAPACITY && capacity >= MIN_CAPACITY) ? MIN_CAPACITY : newCapacity;
+                }
+            };
+
             /**
              * @brief A list implemented by an array.
              * @param T The data type to be held by the list.
+             * @param Policy The growth and shrink policy of the array.
              * @warning This class borrows elements but do not own them: The user should be responsible for deleting them.
              */
-            template<typename T>
+            template<typename T, typename Policy = CapacityPolicy>
             class ArrayList : public yh::structures::lists::List<T> {
                 private:
                     /**
@@ -53,7 +105,12 @@ namespace yh {
                     /**
                      * @brief The maximum capacity of T* the array can hold.
                      */
-                    size_t capacity;
+                    size_t elementsCapacity;
+
+                    /**
+                     * @brief The capacity the array is not shrunk below, set by the constructor and <code>reserve()</code>.
+                     */
+                    size_t reservedCapacity;
 
                     /**
                      * @brief The array of T* that points to every element.
@@ -64,17 +121,120 @@ namespace yh {
                      * @brief The default initial capacity.
                      */
                     static const size_t DEFAULT_INIT_CAPACITY = 16U;
+
+                    /**
+                     * The pointers are trivially copyable, so <code>realloc</code> may extend or cut the array in place without copying.
+                     * @brief Resizes the array to a specific capacity.
+                     * A capacity of 0 is raised to 1, since <code>realloc</code> frees the array for a size of 0.
+                     * @param newCapacity The capacity of the new array, not less than the number of elements.
+                     * @return true if the array is resized, false if memory is not enough, in which case the array is kept.
+                     */
+                    bool reallocate(size_t newCapacity) {
+                        if (newCapacity == 0) {
+                            newCapacity = 1;
+                        }
+                        T **const newArray = static_cast<T **>(realloc(array, newCapacity * sizeof(T *)));
+                        if (newArray == nullptr) {
+                            return false;
+                        }
+                        array = newArray;
+                        elementsCapacity = newCapacity;
+                        return true;
+                    }
+
+                    /**
+                     * @brief Gets the capacity the policy grows the array to, but not less than required.
+                     * @param requiredCapacity The number of elements to be held.
+                     */
+                    size_t grownCapacity(const size_t requiredCapacity) {
+                        const size_t newCapacity = Policy::grow(elementsCapacity, requiredCapacity);
+                        return (newCapacity < requiredCapacity) ? requiredCapacity : newCapacity;
+                    }
+
+                    /**
+                     * @brief Shrinks the array as far as the policy allows after removing elements.
+                     */
+                    void shrinkAfterRemoval() {
+                        size_t newCapacity = Policy::shrink(elementsCapacity, elementsCount);
+                        if (newCapacity < reservedCapacity) {
+                            newCapacity = reservedCapacity;
+                        }
+                        if (newCapacity < elementsCount || newCapacity == 0) {
+                            newCapacity = (elementsCount > 0) ? elementsCount : 1;
+                        }
+                        if (newCapacity < elementsCapacity) {
+                            reallocate(newCapacity);
+                        }
+                    }
+
+                    /**
+                     * @brief Moves the elements at or after a specific index backwards at once, growing the array at most once.
+                     * @param index The index where the gap starts [0, elementsCount].
+                     * @param count The number of elements the gap can hold.
+                     * @return true if the gap is made, false if memory is not enough, in which case the list is kept.
+                     */
+                    bool openGap(const size_t index, const size_t count) {
+                        const size_t requiredCapacity = elementsCount + count;
+                        if (requiredCapacity > elementsCapacity && !reallocate(grownCapacity(requiredCapacity))) {
+                            return false;
+                        }
+                        memmove(array + index + count, array + index, (elementsCount - index) * sizeof(T *));
+                        return true;
+                    }
+
+                    /**
+                     * @brief A visitor that writes the visited elements into consecutive slots of an array.
+                     */
+                    class FillingVisitor : public List<T>::Visitor {
+                        private:
+                            /**
+                             * @brief The slot for the next element.
+                             */
+                            T **position;
+
+                        public:
+                            /**
+                             * @brief Creates a visitor that writes from a specific slot.
+                             * @param slots The slot for the first element.
+                             */
+                            FillingVisitor(T **const slots) : position(slots) {}
+
+                            /**
+                             * @brief Writes an element into the next slot.
+                             * @param elementPointer The element to be written.
+                             */
+                            virtual void visit(T *const elementPointer) override {
+                                *position = elementPointer;
+                                position++;
+                            }
+                    };
                 public:
                     /**
                      * @brief Creates an empty array list.
                      */
-                    ArrayList() : elementsCount(0), capacity(DEFAULT_INIT_CAPACITY), array(new T* [capacity]) {}
+                    ArrayList() : ArrayList(DEFAULT_INIT_CAPACITY) {}
+
+                    /**
+                     * The array is not shrunk below the initial capacity.
+                     * @brief Creates an empty array list which can hold a number of elements before growing its array.
+                     * @param initCapacity The initial capacity of the array.
+                     */
+                    explicit ArrayList(const size_t initCapacity) :
+                        elementsCount(0),
+                        elementsCapacity((initCapacity > 0) ? initCapacity : 1),
+                        reservedCapacity(elementsCapacity),
+                        array(static_cast<T **>(malloc(elementsCapacity * sizeof(T *)))) {
+                        if (array == nullptr) {
+                            // grow the array on the first insertion instead
+                            elementsCapacity = 0;
+                        }
+                    }
 
                     /**
                      * @brief Destroys the array list.
                      */
                     virtual ~ArrayList() {
-                        delete[] array;
+                        free(array);
                     }
 
                     /**
@@ -85,10 +245,46 @@ namespace yh {
                         return elementsCount;
                     }
 
+                    /**
+                     * @brief Gets the number of elements the list can hold before growing its array.
+                     * @return The capacity of the array.
+                     */
+                    size_t capacity() {
+                        return elementsCapacity;
+                    }
+
+                    /**
+                     * The array is not shrunk below this capacity by removing elements, until <code>shrinkToFit()</code> is called.
+                     * @brief Makes the list able to hold a number of elements without growing its array.
+                     * @param newCapacity The number of elements to be held.
+                     * @return true if the capacity is enough, false if memory is not enough.
+                     */
+                    bool reserve(const size_t newCapacity) {
+                        if (newCapacity > elementsCapacity && !reallocate(newCapacity)) {
+                            return false;
+                        }
+                        if (newCapacity > reservedCapacity) {
+                            reservedCapacity = newCapacity;
+                        }
+                        return true;
+                    }
+
+                    /**
+                     * The capacity reserved by the constructor and <code>reserve()</code> is released as well.
+                     * @brief Shrinks the array to the number of elements.
+                     */
+                    void shrinkToFit() {
+                        reservedCapacity = 0;
+                        if (elementsCapacity > elementsCount && elementsCount > 0) {
+                            reallocate(elementsCount);
+                        }
+                    }
+
                     /**
                      * After insertion, the inserted element is accessible at the specific index,
                      * while all elements at or after the specific index before insertion
                      * are moved backwards by 1 unit.
+                     * Nothing is inserted if memory is not enough to grow the array.
                      * @brief Inserts an element at a specific index.
                      * @param index The index where the element is to be inserted [ 0 : size() ].
                      * @param element The element to be inserted.
@@ -98,29 +294,12 @@ namespace yh {
                             return;
                         }
 
-                        if (elementsCount >= capacity) {
-                            // boost capacity
-                            const size_t newCapacity = capacity * 2;
-                            // create a new array
-                            T **const newArray = new T* [newCapacity];
-                            // copy all elements to the left of index to the new array
-                            for (size_t i = 0; i < index; i++) {
-                                newArray[i] = array[i];
-                            }
-                            // copy all elements to the right of index to the new array
-                            for (size_t i = elementsCount; i > index; i--) {
-                                newArray[i] = array[i - 1];
-                            }
-                            // delete the old array
-                            delete[] array;
-                            // transfer the array details to the member variables
-                            array = newArray;
-                            capacity = newCapacity;
-                        } else {
-                            // move all elements to the right of index to the right by 1 unit
-                            for (size_t i = elementsCount; i > index; i--) {
-                                array[i] = array[i - 1];
-                            }
+                        if (elementsCount >= elementsCapacity && !reallocate(grownCapacity(elementsCount + 1))) {
+                            return;
+                        }
+                        // move all elements to the right of index to the right by 1 unit
+                        for (size_t i = elementsCount; i > index; i--) {
+                            array[i] = array[i - 1];
                         }
                         array[index] = element;
                         elementsCount++;
@@ -167,33 +346,98 @@ namespace yh {
 
                         elementsCount--;
 
-                        if (elementsCount * 2 < capacity && elementsCount > DEFAULT_INIT_CAPACITY) {
-                            // shrink capacity
-                            const size_t newCapacity = capacity / 2;
-                            // create a new array
-                            T **const newArray = new T* [newCapacity];
-                            // copy all elements to the left of index to the new array
-                            for (size_t i = 0; i < index; i++) {
-                                newArray[i] = array[i];
-                            }
-                            // copy all elements to the right of index to the new array
-                            for (size_t i = index; i < elementsCount; i++) {
-                                newArray[i] = array[i + 1];
-                            }
-                            // delete the old array
-                            delete[] array;
-                            // transfer the array details to the member variables
-                            array = newArray;
-                            capacity = newCapacity;
-                        } else {
-                            // move all elements to the right of index to the left by 1 unit
-                            for (size_t i = index; i < elementsCount; i++) {
-                                array[i] = array[i + 1];
-                            }
+                        // move all elements to the right of index to the left by 1 unit
+                        for (size_t i = index; i < elementsCount; i++) {
+                            array[i] = array[i + 1];
                         }
+                        shrinkAfterRemoval();
 
                         return toReturn;
                     }
+
+                    /**
+                     * The kept elements are moved forward over the removed ones in a single pass, keeping their order,
+                     * and the capacity is shrunk at most once at the end, so it takes O(n) time.
+                     * @brief Processes each element with a predicate function.
+                     * @param visitor The visitor to visit each element. Return true to remove the element, false otherwise.
+                     * @note Do not add or remove elements in the list within the given function.
+                     */
+                    virtual void removeIf(typename List<T>::PredicateVisitor &visitor) override {
+                        size_t keptCount = 0;
+                        for (size_t i = 0; i < elementsCount; i++) {
+                            T *const element = array[i];
+                            if (!visitor.visit(element)) {
+                                array[keptCount] = element;
+                                keptCount++;
+                            }
+                        }
+                        elementsCount = keptCount;
+                        shrinkAfterRemoval();
+                    }
+
+                    /**
+                     * @brief Processes each element with a predicate function.
+                     * @param func The function to process the elements. param: T* Pointer to the element. return: True to remove the element.
+                     * @note Do not add or remove elements in the list within the given function.
+                     */
+                    virtual void removeIf(bool (*func)(T *)) override {
+                        List<T>::removeIf(func);
+                    }
+
+                    /**
+                     * The elements after the index are moved once and the array grows at most once, so it takes O(n + count) time.
+                     * Nothing is inserted if memory is not enough to grow the array.
+                     * @brief Inserts elements from an array at a specific index.
+                     * @param index The index where the first element is to be inserted [ 0 : size() ].
+                     * @param elements The array of elements to be inserted.
+                     * @param count The number of elements in the array.
+                     */
+                    virtual void insertAll(const size_t index, T *const *elements, const size_t count) override {
+                        if (index > elementsCount || elements == nullptr || count == 0 || !openGap(index, count)) {
+                            return;
+                        }
+                        memcpy(array + index, elements, count * sizeof(T *));
+                        elementsCount += count;
+                    }
+
+                    /**
+                     * The elements after the index are moved once and the array grows at most once, so it takes O(n + list.size()) time.
+                     * Nothing is inserted if memory is not enough to grow the array.
+                     * @brief Inserts all elements of a list at a specific index.
+                     * @param index The index where the first element is to be inserted [ 0 : size() ].
+                     * @param list The list whose elements are to be inserted.
+                     */
+                    virtual void insertAll(const size_t index, List<T> &list) override {
+                        if (&list == this) {
+                            // the gap would be visited, so collect the elements first
+                            List<T>::insertAll(index, list);
+                            return;
+                        }
+                        const size_t count = list.size();
+                        if (index > elementsCount || count == 0 || !openGap(index, count)) {
+                            return;
+                        }
+                        FillingVisitor visitor(array + index);
+                        list.foreach(visitor);
+                        elementsCount += count;
+                    }
+
+                    /**
+                     * The elements after the range are moved once and the array shrinks at most once, so it takes O(n) time.
+                     * @brief Removes the elements in a range of indices.
+                     * @param fromIndex The index of the first element to be removed [ 0 : size() ].
+                     * @param toIndex The index after the last element to be removed [ fromIndex : size() ].
+                     * @return true if the elements are removed, false if the range is invalid.
+                     */
+                    virtual bool removeRange(const size_t fromIndex, const size_t toIndex) override {
+                        if (fromIndex > toIndex || toIndex > elementsCount) {
+                            return false;
+                        }
+                        memmove(array + fromIndex, array + toIndex, (elementsCount - toIndex) * sizeof(T *));
+                        elementsCount -= toIndex - fromIndex;
+                        shrinkAfterRemoval();
+                        return true;
+                    }
             };
         }
     }
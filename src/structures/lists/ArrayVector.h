@@ -0,0 +1,319 @@
+/**
+ * @file ArrayVector.h The array vector implementation in C++.
+ * 
+ * @copyright Copyright (c) 2025 YH Choi. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef YH_STRUCTURES_LISTS_ARRAYVECTOR_H
+#define YH_STRUCTURES_LISTS_ARRAYVECTOR_H
+
+#ifdef ARDUINO
+#include <stddef.h>
+#include <new.h>
+#else
+#include <cstddef>
+#include <new>
+#endif
+
+#include "../../utility/move.h"
+
+namespace yh {
+    namespace structures {
+        namespace lists {
+            /**
+             * Unlike <code>ArrayList</code>, which borrows elements through pointers, this vector owns its elements
+             * and stores them contiguously, so visiting them in order reads memory sequentially.
+             * Elements are constructed in place, and moved rather than copied when the storage grows.
+             * @brief A list of elements stored by value in an array.
+             * @param T The data type to be held by the vector.
+             * @note Pointers to elements are invalidated when the storage grows or elements are removed before them.
+             */
+            template<typename T>
+            class ArrayVector {
+                private:
+                    /**
+                     * @brief The storage, whose first <code>elementsCount</code> slots hold constructed elements.
+                     */
+                    T *elements;
+
+                    /**
+                     * @brief The number of elements stored in this vector.
+                     */
+                    size_t elementsCount;
+
+                    /**
+                     * @brief The number of elements the storage can hold.
+                     */
+                    size_t elementsCapacity;
+
+                    /**
+                     * @brief The capacity of the storage allocated for the first element.
+                     */
+                    static const size_t DEFAULT_INIT_CAPACITY = 16U;
+
+                    /**
+                     * @brief Allocates uninitialized storage for elements.
+                     */
+                    static T *allocate(const size_t capacity) {
+                        return static_cast<T *>(::operator new(capacity * sizeof(T)));
+                    }
+
+                    /**
+                     * Trivially copyable elements are moved with a single <code>memmove</code>.
+                     * @brief Moves the elements to new storage of a specific capacity.
+                     * @param newElements The new storage, which is not less than the number of elements.
+                     * @param newCapacity The capacity of the new storage.
+                     */
+                    void relocate(T *const newElements, const size_t newCapacity) {
+                        utility::relocate(elements, newElements, elementsCount);
+                        if (elements != nullptr) {
+                            ::operator delete(elements);
+                        }
+                        elements = newElements;
+                        elementsCapacity = newCapacity;
+                    }
+
+                    /**
+                     * @brief Gets the capacity after growing for 1 more element.
+                     */
+                    size_t grownCapacity() const {
+                        return (elementsCapacity == 0) ? DEFAULT_INIT_CAPACITY : elementsCapacity * 2;
+                    }
+
+                public:
+                    /**
+                     * No storage is allocated until the first element is added.
+                     * @brief Creates an empty array vector.
+                     */
+                    ArrayVector() : elements(nullptr), elementsCount(0), elementsCapacity(0) {}
+
+                    /**
+                     * @brief Moves the elements of another vector into a new vector, leaving the other vector empty.
+                     * @param other The vector to be moved from.
+                     */
+                    ArrayVector(ArrayVector &&other) : elements(other.elements), elementsCount(other.elementsCount), elementsCapacity(other.elementsCapacity) {
+                        other.elements = nullptr;
+                        other.elementsCount = 0;
+                        other.elementsCapacity = 0;
+                    }
+
+                    /**
+                     * The elements of this vector are destroyed and its storage is freed before taking the elements of the other vector.
+                     * @brief Moves the elements of another vector into this vector, leaving the other vector empty.
+                     * @param other The vector to be moved from.
+                     * @return This vector.
+                     */
+                    ArrayVector &operator=(ArrayVector &&other) {
+                        if (this == &other) {
+                            return *this;
+                        }
+                        clear();
+                        if (elements != nullptr) {
+                            ::operator delete(elements);
+                        }
+                        elements = other.elements;
+                        elementsCount = other.elementsCount;
+                        elementsCapacity = other.elementsCapacity;
+                        other.elements = nullptr;
+                        other.elementsCount = 0;
+                        other.elementsCapacity = 0;
+                        return *this;
+                    }
+
+                    ArrayVector(const ArrayVector &) = delete;
+                    ArrayVector &operator=(const ArrayVector &) = delete;
+
+                    /**
+                     * @brief Destroys the elements and the array vector.
+                     */
+                    ~ArrayVector() {
+                        clear();
+                        if (elements != nullptr) {
+                            ::operator delete(elements);
+                        }
+                    }
+
+                    /**
+                     * @brief Gets the number of elements in the vector.
+                     * @return The number of elements in the vector.
+                     */
+                    size_t size() const {
+                        return elementsCount;
+                    }
+
+                    /**
+                     * @brief Checks whether the vector is empty.
+                     * @return true if the vector is empty, false otherwise.
+                     */
+                    bool isEmpty() const {
+                        return elementsCount == 0;
+                    }
+
+                    /**
+                     * @brief Gets the number of elements the vector can hold without growing its storage.
+                     * @return The capacity of the vector.
+                     */
+                    size_t capacity() const {
+                        return elementsCapacity;
+                    }
+
+                    /**
+                     * The elements are contiguous, so <code>data()[i]</code> is the element at index <code>i</code>.
+                     * @brief Gets the storage of the elements.
+                     * @return The first element, or nullptr if no storage is allocated.
+                     */
+                    T *data() {
+                        return elements;
+                    }
+
+                    /**
+                     * @brief Gets the storage of the elements.
+                     * @return The first element, or nullptr if no storage is allocated.
+                     */
+                    const T *data() const {
+                        return elements;
+                    }
+
+                    /**
+                     * @brief Gets an element at a specific index.
+                     * @param index The index of the requested element [ 0 : size() ).
+                     * @return The requested element, or nullptr if index is invalid.
+                     */
+                    T *get(const size_t index) {
+                        if (index >= elementsCount) {
+                            return nullptr;
+                        }
+                        return elements + index;
+                    }
+
+                    /**
+                     * @brief Gets an element at a specific index.
+                     * @param index The index of the requested element [ 0 : size() ).
+                     * @return The requested element, or nullptr if index is invalid.
+                     */
+                    const T *get(const size_t index) const {
+                        if (index >= elementsCount) {
+                            return nullptr;
+                        }
+                        return elements + index;
+                    }
+
+                    /**
+                     * The elements are moved to new storage at most once, so adding up to <code>capacity</code> elements does not move them again.
+                     * @brief Makes the vector able to hold a number of elements without growing its storage.
+                     * @param capacity The number of elements to be held.  Nothing happens if the capacity is already enough.
+                     */
+                    void reserve(const size_t capacity) {
+                        if (capacity > elementsCapacity) {
+                            relocate(allocate(capacity), capacity);
+                        }
+                    }
+
+                    /**
+                     * The element is constructed before the others are moved when the storage grows,
+                     * so the arguments may refer to elements of this vector.
+                     * @brief Constructs an element in place at the end of the vector.
+                     * @param Args The types of the arguments to the constructor of <code>T</code>.
+                     * @param args The arguments to the constructor of <code>T</code>.
+                     * @return The new element.
+                     */
+                    template<typename... Args>
+                    T *emplaceBack(Args &&...args) {
+                        if (elementsCount < elementsCapacity) {
+                            new (elements + elementsCount) T(utility::forward<Args>(args)...);
+                        } else {
+                            const size_t newCapacity = grownCapacity();
+                            T *const newElements = allocate(newCapacity);
+                            new (newElements + elementsCount) T(utility::forward<Args>(args)...);
+                            relocate(newElements, newCapacity);
+                        }
+                        elementsCount++;
+                        return elements + elementsCount - 1;
+                    }
+
+                    /**
+                     * @brief Copies an element to the end of the vector.
+                     * @param element The element to be copied.
+                     * @return The new element.
+                     */
+                    T *addTail(const T &element) {
+                        return emplaceBack(element);
+                    }
+
+                    /**
+                     * @brief Moves an element to the end of the vector.
+                     * @param element The element to be moved.
+                     * @return The new element.
+                     */
+                    T *addTail(T &&element) {
+                        return emplaceBack(utility::move(element));
+                    }
+
+                    /**
+                     * @brief Destroys the element at the end of the vector.
+                     * @return true if an element is removed, false if the vector is empty.
+                     */
+                    bool removeTail() {
+                        if (elementsCount == 0) {
+                            return false;
+                        }
+                        elementsCount--;
+                        elements[elementsCount].~T();
+                        return true;
+                    }
+
+                    /**
+                     * The elements after the index are moved forward by 1 unit, keeping their order.
+                     * @brief Destroys the element at a specific index.
+                     * @param index The index of the element to be removed [ 0 : size() ).
+                     * @return true if an element is removed, false if index is invalid.
+                     */
+                    bool remove(const size_t index) {
+                        if (index >= elementsCount) {
+                            return false;
+                        }
+                        utility::move_forward(elements + index + 1, elements + index, elementsCount - index - 1);
+                        return removeTail();
+                    }
+
+                    /**
+                     * The storage is kept for the elements to be added later.
+                     * @brief Destroys all elements.
+                     */
+                    void clear() {
+                        while (elementsCount > 0) {
+                            elementsCount--;
+                            elements[elementsCount].~T();
+                        }
+                    }
+            };
+        }
+    }
+}
+
+#endif // #ifndef YH_STRUCTURES_LISTS_ARRAYVECTOR_H
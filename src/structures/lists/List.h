@@ -312,6 +312,91 @@ namespace yh {
                         removeIf(visitor);
                     }
 
+                    /**
+                     * After insertion, the inserted elements are accessible from the specific index in the same order,
+                     * while all elements at or after the specific index before insertion
+                     * are moved backwards by <code>count</code> units.
+                     * @brief Inserts elements from an array at a specific index.
+                     * @param index The index where the first element is to be inserted [ 0 : size() ].
+                     * @param elements The array of elements to be inserted.
+                     * @param count The number of elements in the array.
+                     */
+                    virtual void insertAll(const size_t index, T *const *elements, const size_t count) {
+                        if (index > size() || elements == nullptr) {
+                            return;
+                        }
+                        for (size_t i = 0; i < count; i++) {
+                            insert(index + i, elements[i]);
+                        }
+                    }
+
+                    /**
+                     * The elements are collected before any of them is inserted, so a list can be inserted into itself.
+                     * @brief Inserts all elements of a list at a specific index.
+                     * @param index The index where the first element is to be inserted [ 0 : size() ].
+                     * @param list The list whose elements are to be inserted.
+                     * @see insertAll(const size_t, T *const *, const size_t)
+                     */
+                    virtual void insertAll(const size_t index, List<T> &list) {
+                        const size_t count = list.size();
+                        if (index > size() || count == 0) {
+                            return;
+                        }
+                        class CollectingVisitor : public Visitor {
+                            private:
+                                T **position;
+                            public:
+                                CollectingVisitor(T **elements) : position(elements) {}
+                                virtual void visit(T *const elementPointer) override {
+                                    *position = elementPointer;
+                                    position++;
+                                }
+                        };
+                        T **const elements = new T* [count];
+                        CollectingVisitor visitor(elements);
+                        list.foreach(visitor);
+                        insertAll(index, elements, count);
+                        delete[] elements;
+                    }
+
+                    /**
+                     * Equivalent to <code>insertAll(size(), elements, count)</code>.
+                     * @brief Adds elements from an array to the tail of the list.
+                     * @param elements The array of elements to be added.
+                     * @param count The number of elements in the array.
+                     * @see insertAll()
+                     */
+                    virtual void addAllTail(T *const *elements, const size_t count) {
+                        insertAll(size(), elements, count);
+                    }
+
+                    /**
+                     * Equivalent to <code>insertAll(size(), list)</code>.
+                     * @brief Adds all elements of a list to the tail of the list.
+                     * @param list The list whose elements are to be added.
+                     * @see insertAll()
+                     */
+                    virtual void addAllTail(List<T> &list) {
+                        insertAll(size(), list);
+                    }
+
+                    /**
+                     * All elements after the range are moved forwards by <code>toIndex - fromIndex</code> units.
+                     * @brief Removes the elements in a range of indices.
+                     * @param fromIndex The index of the first element to be removed [ 0 : size() ].
+                     * @param toIndex The index after the last element to be removed [ fromIndex : size() ].
+                     * @return true if the elements are removed, false if the range is invalid.
+                     */
+                    virtual bool removeRange(const size_t fromIndex, const size_t toIndex) {
+                        if (fromIndex > toIndex || toIndex > size()) {
+                            return false;
+                        }
+                        for (size_t i = fromIndex; i < toIndex; i++) {
+                            remove(fromIndex);
+                        }
+                        return true;
+                    }
+
                     /**
                      * @brief An iterator used to visit elements of a list.
                      */
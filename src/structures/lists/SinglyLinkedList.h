@@ -114,6 +114,93 @@ namespace yh {
                         return prevData;
                     }
 
+                    /**
+                     * @brief Unlinks a node from the list and deletes it.
+                     * @param prevNode The node before the node to be removed, or nullptr if it is the head.
+                     * @param node The node to be removed.
+                     * @return The node after the removed node.
+                     */
+                    Node *removeNode(Node *const prevNode, Node *const node) {
+                        elementsCount--;
+
+                        Node *const nextNode = node->next;
+                        if (node == head) {
+                            head = nextNode;
+                        }
+                        if (node == tail) {
+                            tail = prevNode;
+                        }
+                        if (prevNode != nullptr) {
+                            prevNode->next = nextNode;
+                        }
+                        delete node;
+                        return nextNode;
+                    }
+
+                    /**
+                     * @brief A visitor that links the visited elements into a chain of new nodes, to be spliced into a list at once.
+                     */
+                    class ChainingVisitor : public List<T>::Visitor {
+                        public:
+                            /**
+                             * @brief The first node in the chain, or nullptr if the chain is empty.
+                             */
+                            Node *first;
+
+                            /**
+                             * @brief The last node in the chain, or nullptr if the chain is empty.
+                             */
+                            Node *last;
+
+                            /**
+                             * @brief The number of nodes in the chain.
+                             */
+                            size_t count;
+
+                            /**
+                             * @brief Creates an empty chain.
+                             */
+                            ChainingVisitor() : first(nullptr), last(nullptr), count(0) {}
+
+                            /**
+                             * @brief Appends a new node to the chain.
+                             * @param elementPointer The data to be pointed by the new node.
+                             */
+                            virtual void visit(T *const elementPointer) override {
+                                Node *const node = new Node(elementPointer);
+                                if (first == nullptr) {
+                                    first = node;
+                                } else {
+                                    last->next = node;
+                                }
+                                last = node;
+                                count++;
+                            }
+                    };
+
+                    /**
+                     * @brief Links a chain of new nodes into the list at a specific index.
+                     * @param index The index where the first node is to be linked [0, elementsCount].
+                     * @param chain The chain to be linked, which may be empty.
+                     */
+                    void spliceChain(const size_t index, const ChainingVisitor &chain) {
+                        if (chain.count == 0) {
+                            return;
+                        }
+                        if (index == 0) {
+                            chain.last->next = head;
+                            head = chain.first;
+                        } else {
+                            Node *const prevNode = (index == elementsCount) ? tail : getNode(index - 1);
+                            chain.last->next = prevNode->next;
+                            prevNode->next = chain.first;
+                        }
+                        if (index == elementsCount) {
+                            tail = chain.last;
+                        }
+                        elementsCount += chain.count;
+                    }
+
                 public:
                     /**
                      * @brief Creates an empty singly linked list.
@@ -385,20 +472,7 @@ namespace yh {
                         while (node != nullptr) {
                             const bool needToRemove = visitor.visit(node->data);
                             if (needToRemove) {
-                                elementsCount--;
-
-                                Node *const nextNode = node->next;
-                                if (node == head) {
-                                    head = nextNode;
-                                }
-                                if (node == tail) {
-                                    tail = prevNode;
-                                }
-                                if (prevNode != nullptr) {
-                                    prevNode->next = nextNode;
-                                }
-                                delete node;
-                                node = nextNode;
+                                node = removeNode(prevNode, node);
                             } else {
                                 prevNode = node;
                                 node = node->next;
@@ -423,6 +497,162 @@ namespace yh {
                     virtual void removeIf(bool (*func)(T *)) override {
                         List<T>::removeIf(func);
                     }
+
+                    /**
+                     * The new nodes are linked into a chain first and spliced into the list at once,
+                     * so the list is walked only once to find the index.
+                     * @brief Inserts elements from an array at a specific index.
+                     * @param index The index where the first element is to be inserted [ 0 : size() ].
+                     * @param elements The array of elements to be inserted.
+                     * @param count The number of elements in the array.
+                     */
+                    virtual void insertAll(const size_t index, T *const *elements, const size_t count) override {
+                        if (index > elementsCount || elements == nullptr) {
+                            return;
+                        }
+                        ChainingVisitor chain;
+                        for (size_t i = 0; i < count; i++) {
+                            chain.visit(elements[i]);
+                        }
+                        spliceChain(index, chain);
+                    }
+
+                    /**
+                     * The new nodes are linked into a chain first and spliced into the list at once,
+                     * so the list is walked only once to find the index, and a list can be inserted into itself.
+                     * @brief Inserts all elements of a list at a specific index.
+                     * @param index The index where the first element is to be inserted [ 0 : size() ].
+                     * @param list The list whose elements are to be inserted.
+                     */
+                    virtual void insertAll(const size_t index, List<T> &list) override {
+                        if (index > elementsCount) {
+                            return;
+                        }
+                        ChainingVisitor chain;
+                        list.foreach(chain);
+                        spliceChain(index, chain);
+                    }
+
+                    /**
+                     * The list is walked only once to find the range.
+                     * @brief Removes the elements in a range of indices.
+                     * @param fromIndex The index of the first element to be removed [ 0 : size() ].
+                     * @param toIndex The index after the last element to be removed [ fromIndex : size() ].
+                     * @return true if the elements are removed, false if the range is invalid.
+                     */
+                    virtual bool removeRange(const size_t fromIndex, const size_t toIndex) override {
+                        if (fromIndex > toIndex || toIndex > elementsCount) {
+                            return false;
+                        } else if (fromIndex == toIndex) {
+                            return true;
+                        }
+
+                        Node *const prevNode = (fromIndex == 0) ? nullptr : getNode(fromIndex - 1);
+                        Node *node = (prevNode == nullptr) ? head : prevNode->next;
+                        for (size_t i = fromIndex; i < toIndex; i++) {
+                            Node *const thisNode = node;
+                            node = node->next;
+                            delete thisNode;
+                        }
+                        if (prevNode == nullptr) {
+                            head = node;
+                        } else {
+                            prevNode->next = node;
+                        }
+                        if (node == nullptr) {
+                            tail = prevNode;
+                        }
+                        elementsCount -= toIndex - fromIndex;
+                        return true;
+                    }
+
+                    /**
+                     * It walks the nodes instead of indexing the list, so a whole traversal takes O(n) time.
+                     * @brief An iterator used to visit elements of a singly linked list.
+                     * @note Do not add or remove elements in the list other than through the iterator while it is in use.
+                     */
+                    class Iterator {
+                        private:
+                            /**
+                             * @brief The list visited by this iterator.
+                             */
+                            SinglyLinkedList<T> &list;
+
+                            /**
+                             * @brief The node before the current node, or nullptr if the current node is the head.
+                             */
+                            Node *prevNode;
+
+                            /**
+                             * @brief The node pointed by this iterator, or nullptr after the last element.
+                             */
+                            Node *node;
+
+                            /**
+                             * @brief Whether the current element is removed.
+                             */
+                            bool isRemoved;
+
+                        public:
+                            /**
+                             * @brief Creates a new iterator to visit elements of a singly linked list.
+                             * @param list The list being visited.
+                             */
+                            Iterator(SinglyLinkedList<T> &list) : list(list), prevNode(nullptr), node(list.head), isRemoved(false)
+                            {
+                                //
+                            }
+
+                            /**
+                             * @brief Whether there are unvisited elements in the list.
+                             * @return `true` if there are unvisited elements, `false` otherwise.
+                             */
+                            bool hasNext() {
+                                return node != nullptr;
+                            }
+
+                            /**
+                             * A nullptr will be returned after removing the current element.
+                             * @brief Get the current element pointed by the iterator.
+                             * @return The current element pointed by the iterator, or nullptr if it does not exist.
+                             * @see remove()
+                             */
+                            T *get() {
+                                if (node == nullptr || isRemoved) {
+                                    return nullptr;
+                                }
+                                return node->data;
+                            }
+
+                            /**
+                             * Each element could only be removed once.
+                             * Calling this function repetitively will not remove any other elements from the list.
+                             * @brief Remove the current element from the list.
+                             * @return The element removed, or nullptr if none is removed.
+                             * @see get()
+                             */
+                            T *remove() {
+                                if (node == nullptr || isRemoved) {
+                                    return nullptr;
+                                }
+                                isRemoved = true;
+                                T *const data = node->data;
+                                node = list.removeNode(prevNode, node);
+                                return data;
+                            }
+
+                            /**
+                             * @brief Move on to the next element.
+                             */
+                            void proceed() {
+                                if (isRemoved) {
+                                    isRemoved = false;
+                                } else if (node != nullptr) {
+                                    prevNode = node;
+                                    node = node->next;
+                                }
+                            }
+                    };
             };
         }
     }
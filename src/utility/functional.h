@@ -0,0 +1,104 @@
+/**
+ * @file functional.h The comparators and key projections.
+ * 
+ * @copyright Copyright (c) 2025 YH Choi. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef YH_UTILITY_FUNCTIONAL_H
+#define YH_UTILITY_FUNCTIONAL_H
+
+namespace yh {
+    namespace utility {
+        /**
+         * This is the default comparator of all sorts.
+         * @brief Compares 2 objects with <code>operator&lt;</code>.
+         */
+        struct Less {
+            template<typename T>
+            inline bool operator()(const T &lhs, const T &rhs) const {
+                return lhs < rhs;
+            }
+        };
+
+        /**
+         * Sorting with this comparator gives descending order.
+         * @brief Compares 2 objects with <code>operator&lt;</code> reversed.
+         */
+        struct Greater {
+            template<typename T>
+            inline bool operator()(const T &lhs, const T &rhs) const {
+                return rhs < lhs;
+            }
+        };
+
+        /**
+         * @brief Compares 2 objects by the keys projected from them.
+         * @param Key The type of the projection, which maps an object to its key.
+         * @param Compare The type of the comparator of keys.
+         */
+        template<typename Key, typename Compare = Less>
+        class KeyCompare {
+            private:
+                Key key;
+                Compare compare;
+
+            public:
+                KeyCompare(const Key &key, const Compare &compare) : key(key), compare(compare) {}
+
+                template<typename T>
+                inline bool operator()(const T &lhs, const T &rhs) const {
+                    return compare(key(lhs), key(rhs));
+                }
+        };
+
+        /**
+         * The key is projected on every comparison, so it should be cheap, e.g. a field access.
+         * @brief Creates a comparator ordering objects by a key.
+         * @param key The projection mapping an object to its key, e.g. a lambda returning a field.
+         * @return The comparator comparing the keys with <code>operator&lt;</code>.
+         */
+        template<typename Key>
+        inline KeyCompare<Key> by_key(const Key &key) {
+            return KeyCompare<Key>(key, Less());
+        }
+
+        /**
+         * The key is projected on every comparison, so it should be cheap, e.g. a field access.
+         * @brief Creates a comparator ordering objects by a key.
+         * @param key The projection mapping an object to its key, e.g. a lambda returning a field.
+         * @param compare The comparator of keys.
+         * @return The comparator comparing the keys with <code>compare</code>.
+         */
+        template<typename Key, typename Compare>
+        inline KeyCompare<Key, Compare> by_key(const Key &key, const Compare &compare) {
+            return KeyCompare<Key, Compare>(key, compare);
+        }
+    }
+}
+
+#endif // #ifndef YH_UTILITY_FUNCTIONAL_H
\ No newline at end of file
@@ -0,0 +1,163 @@
+/**
+ * @file move.h The move, swap and bulk relocation helpers.
+ * 
+ * @copyright Copyright (c) 2025 YH Choi. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef YH_UTILITY_MOVE_H
+#define YH_UTILITY_MOVE_H
+
+#ifdef ARDUINO
+#include <new.h>
+#include <stddef.h>
+#include <string.h>
+#else
+#include <cstddef>
+#include <cstring>
+#include <new>
+#endif
+
+#include "type_traits.h"
+
+namespace yh {
+    namespace utility {
+        /**
+         * @brief Casts an object to an rvalue reference, so that it is moved instead of copied.
+         */
+        template<typename T>
+        inline typename RemoveReference<T>::Type &&move(T &&value) {
+            return static_cast<typename RemoveReference<T>::Type &&>(value);
+        }
+
+        /**
+         * @brief Passes an argument on with the value category it was given with.
+         */
+        template<typename T>
+        inline T &&forward(typename RemoveReference<T>::Type &value) {
+            return static_cast<T &&>(value);
+        }
+
+        /**
+         * @brief Swaps 2 objects with 3 moves instead of 3 copies.
+         */
+        template<typename T>
+        inline void swap(T &lhs, T &rhs) {
+            T temp = utility::move(lhs); // move lhs to temp
+            lhs = utility::move(rhs); // move rhs to lhs
+            rhs = utility::move(temp); // move temp to rhs
+        }
+
+        namespace _move {
+            template<bool IS_TRIVIALLY_COPYABLE>
+            struct Relocation {
+                template<typename T>
+                static inline void forward(T *const source, T *const destination, const size_t count) {
+                    for (size_t i = 0; i < count; ++i) {
+                        destination[i] = utility::move(source[i]);
+                    }
+                }
+
+                template<typename T>
+                static inline void backward(T *const source, T *const destination, const size_t count) {
+                    for (size_t i = count; i > 0; --i) {
+                        destination[i - 1] = utility::move(source[i - 1]);
+                    }
+                }
+
+                template<typename T>
+                static inline void uninitialized(T *const source, T *const destination, const size_t count) {
+                    for (size_t i = 0; i < count; ++i) {
+                        new (destination + i) T(utility::move(source[i]));
+                        source[i].~T();
+                    }
+                }
+            };
+
+            template<>
+            struct Relocation<true> {
+                template<typename T>
+                static inline void forward(T *const source, T *const destination, const size_t count) {
+                    if (count > 0) {
+                        memmove(destination, source, count * sizeof(T));
+                    }
+                }
+
+                template<typename T>
+                static inline void backward(T *const source, T *const destination, const size_t count) {
+                    if (count > 0) {
+                        memmove(destination, source, count * sizeof(T));
+                    }
+                }
+
+                template<typename T>
+                static inline void uninitialized(T *const source, T *const destination, const size_t count) {
+                    forward(source, destination, count);
+                }
+            };
+        }
+
+        /**
+         * Trivially copyable elements are moved with a single <code>memmove</code>.
+         * @brief Moves elements from front to back, which is safe when <code>destination</code> is not after <code>source</code>.
+         * @param source The first element to be moved from.  The moved-from elements are left valid but unspecified.
+         * @param destination The first element to be moved to.
+         * @param count The number of elements to be moved.
+         */
+        template<typename T>
+        inline void move_forward(T *const source, T *const destination, const size_t count) {
+            _move::Relocation<IsTriviallyCopyable<T>::VALUE>::forward(source, destination, count);
+        }
+
+        /**
+         * Trivially copyable elements are moved with a single <code>memmove</code>.
+         * @brief Moves elements from back to front, which is safe when <code>destination</code> is not before <code>source</code>.
+         * @param source The first element to be moved from.  The moved-from elements are left valid but unspecified.
+         * @param destination The first element to be moved to.
+         * @param count The number of elements to be moved.
+         */
+        template<typename T>
+        inline void move_backward(T *const source, T *const destination, const size_t count) {
+            _move::Relocation<IsTriviallyCopyable<T>::VALUE>::backward(source, destination, count);
+        }
+
+        /**
+         * Trivially copyable elements are moved with a single <code>memmove</code>,
+         * otherwise each element is move-constructed at its new place and destroyed at its old place.
+         * @brief Moves elements into uninitialized storage, ending their lifetimes at their old places.
+         * @param source The first element to be moved from.  The elements are destroyed, leaving raw storage.
+         * @param destination The uninitialized storage to move the elements to, which does not overlap with them.
+         * @param count The number of elements to be moved.
+         */
+        template<typename T>
+        inline void relocate(T *const source, T *const destination, const size_t count) {
+            _move::Relocation<IsTriviallyCopyable<T>::VALUE>::uninitialized(source, destination, count);
+        }
+    }
+}
+
+#endif // #ifndef YH_UTILITY_MOVE_H
\ No newline at end of file
@@ -0,0 +1,113 @@
+/**
+ * @file type_traits.h The minimal type traits without STL.
+ * 
+ * @copyright Copyright (c) 2025 YH Choi. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef YH_UTILITY_TYPE_TRAITS_H
+#define YH_UTILITY_TYPE_TRAITS_H
+
+namespace yh {
+    namespace utility {
+        /**
+         * @brief Whether 2 types are the same type.
+         */
+        template<typename T, typename U> struct IsSame { static const bool VALUE = false; };
+        template<typename T> struct IsSame<T, T> { static const bool VALUE = true; };
+
+        /**
+         * @brief Gets the type referred to by a reference type.
+         */
+        template<typename T> struct RemoveReference { typedef T Type; };
+        template<typename T> struct RemoveReference<T &> { typedef T Type; };
+        template<typename T> struct RemoveReference<T &&> { typedef T Type; };
+
+        /**
+         * @brief Gets the type without its reference and top-level const qualifier.
+         */
+        template<typename T> struct Decay { typedef T Type; };
+        template<typename T> struct Decay<const T> { typedef T Type; };
+        template<typename T> struct Decay<T &> { typedef T Type; };
+        template<typename T> struct Decay<const T &> { typedef T Type; };
+        template<typename T> struct Decay<T &&> { typedef T Type; };
+        template<typename T> struct Decay<const T &&> { typedef T Type; };
+
+        /**
+         * @brief Whether a type is a built-in integer type.
+         */
+        template<typename T> struct IsIntegral { static const bool VALUE = false; };
+        template<> struct IsIntegral<bool> { static const bool VALUE = true; };
+        template<> struct IsIntegral<char> { static const bool VALUE = true; };
+        template<> struct IsIntegral<signed char> { static const bool VALUE = true; };
+        template<> struct IsIntegral<unsigned char> { static const bool VALUE = true; };
+        template<> struct IsIntegral<short> { static const bool VALUE = true; };
+        template<> struct IsIntegral<unsigned short> { static const bool VALUE = true; };
+        template<> struct IsIntegral<int> { static const bool VALUE = true; };
+        template<> struct IsIntegral<unsigned int> { static const bool VALUE = true; };
+        template<> struct IsIntegral<long> { static const bool VALUE = true; };
+        template<> struct IsIntegral<unsigned long> { static const bool VALUE = true; };
+        template<> struct IsIntegral<long long> { static const bool VALUE = true; };
+        template<> struct IsIntegral<unsigned long long> { static const bool VALUE = true; };
+
+        /**
+         * @brief Whether a type is a built-in floating point type.
+         */
+        template<typename T> struct IsFloatingPoint { static const bool VALUE = false; };
+        template<> struct IsFloatingPoint<float> { static const bool VALUE = true; };
+        template<> struct IsFloatingPoint<double> { static const bool VALUE = true; };
+        template<> struct IsFloatingPoint<long double> { static const bool VALUE = true; };
+
+        /**
+         * @brief Whether a type is a built-in integer or floating point type.
+         */
+        template<typename T> struct IsArithmetic { static const bool VALUE = IsIntegral<T>::VALUE || IsFloatingPoint<T>::VALUE; };
+
+        /**
+         * @brief Whether a type is a pointer type.
+         */
+        template<typename T> struct IsPointer { static const bool VALUE = false; };
+        template<typename T> struct IsPointer<T *> { static const bool VALUE = true; };
+
+        /**
+         * Objects of such types can be copied and moved byte by byte with <code>memcpy</code> and <code>memmove</code>.
+         * The compiler builtin is used where available; otherwise only arithmetic and pointer types are assumed trivially copyable,
+         * and this template may be specialised for other plain structs.
+         * @brief Whether a type is trivially copyable.
+         */
+        template<typename T>
+        struct IsTriviallyCopyable {
+#if defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER)
+            static const bool VALUE = __is_trivially_copyable(T);
+#else
+            static const bool VALUE = IsArithmetic<T>::VALUE || IsPointer<T>::VALUE;
+#endif
+        };
+    }
+}
+
+#endif // #ifndef YH_UTILITY_TYPE_TRAITS_H
\ No newline at end of file